@@ -33,7 +33,7 @@
 #include "fff.h"
 
 extern "C" {
-#include "core_cm4_mock.h"
+#include "stm32f429xx_mock.h"
 }
 
 //-----------------------------------------------------------------------------------------------------------------------------
@@ -59,6 +59,12 @@ FAKE_VOID_FUNC(NVIC_SetVector, IRQn_Type, uint32_t);
 FAKE_VALUE_FUNC(uint32_t, NVIC_GetVector, IRQn_Type);
 FAKE_VOID_FUNC(NVIC_SystemReset);
 FAKE_VALUE_FUNC(uint32_t, SCB_GetFPUType);
+FAKE_VOID_FUNC(__enable_irq);
+FAKE_VOID_FUNC(__disable_irq);
+FAKE_VALUE_FUNC(uint32_t, __get_PRIMASK);
+FAKE_VOID_FUNC(__set_PRIMASK, uint32_t);
+FAKE_VOID_FUNC(__WFI);
+FAKE_VOID_FUNC(__DMB);
 FAKE_VALUE_FUNC(uint32_t, SysTick_Config, uint32_t);
 FAKE_VALUE_FUNC(uint32_t, ITM_SendChar, uint32_t);
 FAKE_VALUE_FUNC(int32_t, ITM_ReceiveChar);
@@ -89,6 +95,12 @@ FAKE_VALUE_FUNC(int32_t, ITM_CheckChar);
     RESET_FAKE(NVIC_GetVector); \
     RESET_FAKE(NVIC_SystemReset); \
     RESET_FAKE(SCB_GetFPUType); \
+    RESET_FAKE(__enable_irq); \
+    RESET_FAKE(__disable_irq); \
+    RESET_FAKE(__get_PRIMASK); \
+    RESET_FAKE(__set_PRIMASK); \
+    RESET_FAKE(__WFI); \
+    RESET_FAKE(__DMB); \
     RESET_FAKE(SysTick_Config); \
     RESET_FAKE(ITM_SendChar); \
     RESET_FAKE(ITM_ReceiveChar); \
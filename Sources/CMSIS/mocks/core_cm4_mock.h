@@ -1335,6 +1335,7 @@ extern FPU_Type fpu;
 #define SCnSCB              (&scnScb)     /*!< System control Register not in SCB */
 #define SCB                 (&scb)        /*!< SCB configuration struct */
 #define SYSTICK             (&sysTick)    /*!< SysTick configuration struct */
+#define SysTick             (&sysTick)    /*!< SysTick configuration struct, CMSIS name */
 #define NVIC                (&nvic)       /*!< NVIC configuration struct */
 #define ITM                 (&itm)        /*!< ITM configuration struct */
 #define DWT                 (&dwt)        /*!< DWT configuration struct */
@@ -1379,6 +1380,14 @@ void NVIC_SystemReset(void);
 #include "mpu_armv7_mock.h"
 
 uint32_t SCB_GetFPUType(void);
+
+/* Core intrinsics of cmsis_gcc.h as mockable functions */
+void __enable_irq(void);
+void __disable_irq(void);
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t priMask);
+void __WFI(void);
+void __DMB(void);
 uint32_t SysTick_Config(uint32_t ticks);
 
 #define                 ITM_RXBUFFER_EMPTY  ((int32_t)0x5AA55AA5U) /*!< Value identifying \ref ITM_RxBuffer is ready for next character. */
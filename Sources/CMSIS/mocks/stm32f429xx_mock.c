@@ -31,6 +31,12 @@
 
 #include <stm32f429xx_mock.h>
 
+//-----------------------------------------------------------------------------------------------------------------------------
+// System Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+uint32_t SystemCoreClock = 16000000UL;    // HSI clock after reset.
+
 //-----------------------------------------------------------------------------------------------------------------------------
 // Peripheral Mock Structs
 //-----------------------------------------------------------------------------------------------------------------------------
@@ -1021,6 +1021,8 @@ typedef struct
 #define HAL_DMA_STREAMS_MAX   16
 #define HAL_USBS_MAX          2
 
+extern uint32_t SystemCoreClock;
+
 extern TIM_TypeDef timers[HAL_TIMERS_MAX];
 extern RTC_TypeDef rtc;
 extern WWDG_TypeDef wwdg;
@@ -22,6 +22,24 @@
 //! @date    18 Apr 2020
 //! 
 //! @brief   This is an simplified example of an ADC module.
+//! The driver runs single conversions of regular channels on ADC1. A conversion is started by software and its result
+//! is passed to the callback of the channel from the end of conversion interrupt.
+//! The conversion time is the sample time plus one ADC clock cycle per bit of resolution, so a lower resolution and a
+//! shorter sample time give a higher rate. ADC_MAX_VALUE() gives the full scale of a resolution at compile time.
+//! An injected sequence converts up to four channels with a callback each. It suspends a running single conversion
+//! or scan and is converted at once, so priority measurements do not wait behind a long scan.
+//! A scan converts a list of channels continuously into a circular buffer through DMA. The buffer is split into two
+//! blocks, and the block callback is called from the DMA interrupt whenever one of them has been filled, so the CPU is
+//! interrupted twice per buffer instead of once per sample.
+//! A scan runs continuously or is triggered by the TRGO output of a timer, which the driver runs at the given scan rate.
+//! A timer trigger converts the sequence once per period at evenly spaced instants, independent of the scheduling. The
+//! timer clocks are expected to equal SystemCoreClock, i.e. the APB prescalers are 1 or 2.
+//! The analog watchdog guards one channel against a window of results in hardware. It interrupts only when a
+//! conversion of the channel falls outside the window, so a running scan can be supervised without looking at every
+//! block. The watchdog disarms itself on the first result outside the window and is armed again by enabling it.
+//! A capture samples one channel with ADC1, ADC2 and ADC3 interleaved, i.e. one result per five ADC clock cycles, into
+//! a circular buffer. It is triggered by the analog watchdogs or by software and ends once enough samples have been
+//! stored after the trigger. The buffer is then handed over to the callback in place, without copying.
 
 #ifndef ADC_H
 #define ADC_H
@@ -32,6 +50,23 @@
 
 #include "types.h"
 
+//-----------------------------------------------------------------------------------------------------------------------------
+// Defines
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#define ADC_SCAN_MAX_CHANNELS           16U         //!< Maximum number of channels in a scan.
+#define ADC_INJECTED_MAX_CHANNELS       4U          //!< Maximum number of channels in the injected sequence.
+#define ADC_SCAN_MAX_BUFFER_LENGTH      0xFFFFUL    //!< Maximum scan buffer length in samples.
+#define ADC_WATCHDOG_MAX_THRESHOLD      0xFFFU      //!< Maximum analog watchdog threshold.
+#define ADC_CAPTURE_MAX_BUFFER_LENGTH   0x1FFFCUL   //!< Maximum capture buffer length in samples.
+#define ADC_POOL_BLOCK_COUNT            4U          //!< Number of blocks the driver lends from its pool.
+#define ADC_POOL_BLOCK_LENGTH           64U         //!< Length of a pool block in samples.
+
+//! Number of bits in the results of a resolution.
+#define ADC_RESOLUTION_BITS(resolution_)    (12UL - (2UL * (uint32_t)(resolution_)))
+//! Maximum result of a resolution.
+#define ADC_MAX_VALUE(resolution_)          ((1UL << ADC_RESOLUTION_BITS(resolution_)) - 1UL)
+
 //-----------------------------------------------------------------------------------------------------------------------------
 // Typedefs
 //-----------------------------------------------------------------------------------------------------------------------------
@@ -40,12 +75,33 @@
 /// Parameter is the ADC result.
 typedef void (*AdcCallback_t)(uint16_t);
 
-/// @brief An ADC channel enum
+/// @brief A function pointer type for ADC block callbacks.
+/// Parameters are a pointer to the first sample of the block and the number of samples in the block.
+typedef void (*AdcBlockCallback_t)(const uint16_t*, uint32_t);
+
+/// @brief An ADC channel enum. Channels 16, 17 and 18 are the internal temperature sensor, VREFINT and VBAT.
 typedef enum
 {
-    ADC0 = 0,   //!< ADC channel 0
-    ADC1,       //!< ADC channel 1
-    ADC2        //!< ADC channel 2
+    ADC_CHANNEL_0 = 0,  //!< ADC channel 0
+    ADC_CHANNEL_1,      //!< ADC channel 1
+    ADC_CHANNEL_2,      //!< ADC channel 2
+    ADC_CHANNEL_3,      //!< ADC channel 3
+    ADC_CHANNEL_4,      //!< ADC channel 4
+    ADC_CHANNEL_5,      //!< ADC channel 5
+    ADC_CHANNEL_6,      //!< ADC channel 6
+    ADC_CHANNEL_7,      //!< ADC channel 7
+    ADC_CHANNEL_8,      //!< ADC channel 8
+    ADC_CHANNEL_9,      //!< ADC channel 9
+    ADC_CHANNEL_10,     //!< ADC channel 10
+    ADC_CHANNEL_11,     //!< ADC channel 11
+    ADC_CHANNEL_12,     //!< ADC channel 12
+    ADC_CHANNEL_13,     //!< ADC channel 13
+    ADC_CHANNEL_14,     //!< ADC channel 14
+    ADC_CHANNEL_15,     //!< ADC channel 15
+    ADC_CHANNEL_16,     //!< ADC channel 16
+    ADC_CHANNEL_17,     //!< ADC channel 17
+    ADC_CHANNEL_18,     //!< ADC channel 18
+    ADC_CHANNEL_COUNT   //!< Number of ADC channels
 } AdcChannel_t;
 
 /// @brief ADC channel resolution
@@ -56,14 +112,106 @@ typedef enum
     ADC_RES_8_BIT       //!< 8-bit resolution
 } AdcResolution_t;
 
+/// @brief ADC channel sample time in ADC clock cycles. A high impedance source needs a long sample time.
+typedef enum
+{
+    ADC_SAMPLE_TIME_3_CYCLES = 0,   //!< 3 cycles
+    ADC_SAMPLE_TIME_15_CYCLES,      //!< 15 cycles
+    ADC_SAMPLE_TIME_28_CYCLES,      //!< 28 cycles
+    ADC_SAMPLE_TIME_56_CYCLES,      //!< 56 cycles
+    ADC_SAMPLE_TIME_84_CYCLES,      //!< 84 cycles
+    ADC_SAMPLE_TIME_112_CYCLES,     //!< 112 cycles
+    ADC_SAMPLE_TIME_144_CYCLES,     //!< 144 cycles
+    ADC_SAMPLE_TIME_480_CYCLES,     //!< 480 cycles
+    ADC_SAMPLE_TIME_COUNT           //!< Number of sample times
+} AdcSampleTime_t;
+
+/// @brief ADC scan trigger source
+typedef enum
+{
+    ADC_TRIGGER_CONTINUOUS = 0, //!< Scans are started by software and run back to back.
+    ADC_TRIGGER_TIM2_TRGO,      //!< Each TIM2 update starts a scan.
+    ADC_TRIGGER_TIM3_TRGO,      //!< Each TIM3 update starts a scan.
+    ADC_TRIGGER_TIM8_TRGO,      //!< Each TIM8 update starts a scan.
+    ADC_TRIGGER_COUNT           //!< Number of trigger sources
+} AdcTrigger_t;
+
 /// @brief ADC configuration struct
 typedef struct
 {
     AdcChannel_t channel;       //!< A channel selector
     AdcResolution_t resolution; //!< A channel resolution
+    AdcSampleTime_t sampleTime; //!< A channel sample time
     AdcCallback_t Callback;     //!< A callback for passing results.
 } AdcConfig_t;
 
+/// @brief ADC injected channel struct
+typedef struct
+{
+    AdcChannel_t channel;       //!< A channel selector
+    AdcSampleTime_t sampleTime; //!< A channel sample time
+    AdcCallback_t Callback;     //!< A callback for passing the result of the channel.
+} AdcInjectedChannel_t;
+
+/// @brief ADC injected sequence configuration struct
+typedef struct
+{
+    const AdcInjectedChannel_t* pChannels;  //!< Channels in conversion order.
+    uint32_t channelCount;                  //!< Number of channels, 1 to ADC_INJECTED_MAX_CHANNELS.
+} AdcInjectedConfig_t;
+
+/// @brief ADC scan configuration struct
+typedef struct
+{
+    const AdcChannel_t* pChannels;  //!< Channels in conversion order.
+    uint32_t channelCount;          //!< Number of channels, 1 to ADC_SCAN_MAX_CHANNELS.
+    AdcResolution_t resolution;     //!< Resolution of all channels.
+    AdcSampleTime_t sampleTime;     //!< Sample time of all channels.
+    uint16_t* pBuffer;              //!< A buffer of two blocks. Each scan stores one sample per channel in channel order.
+                                    //!< NULL to lend blocks from the pool of the driver.
+    uint32_t bufferLength;          //!< Buffer length in samples. A multiple of 2 * channelCount and at most
+                                    //!< ADC_SCAN_MAX_BUFFER_LENGTH, or at most 2 * ADC_POOL_BLOCK_LENGTH with the pool.
+    AdcBlockCallback_t Callback;    //!< A callback for passing filled blocks.
+    AdcTrigger_t trigger;           //!< Scan trigger source.
+    uint32_t scanRate;              //!< Scans per second for timer triggers. Not used in the continuous mode.
+} AdcScanConfig_t;
+
+/// @brief ADC analog watchdog configuration struct
+typedef struct
+{
+    AdcChannel_t channel;       //!< A guarded channel.
+    uint16_t lowThreshold;      //!< Results below this are outside the window.
+    uint16_t highThreshold;     //!< Results above this are outside the window. At most ADC_WATCHDOG_MAX_THRESHOLD.
+    AdcCallback_t Callback;     //!< A callback for the first result outside the window.
+} AdcWatchdogConfig_t;
+
+/// @brief A finished ADC capture. The samples are in the capture buffer in DMA order, so they wrap around its end.
+typedef struct
+{
+    const uint16_t* pBuffer;    //!< The capture buffer.
+    uint32_t length;            //!< Buffer length in samples.
+    uint32_t firstIndex;        //!< Index of the oldest sample.
+    uint32_t triggerIndex;      //!< Index of the first sample after the trigger.
+} AdcCapture_t;
+
+/// @brief A function pointer type for ADC capture callbacks.
+/// Parameter is a pointer to the finished capture. The descriptor is valid only during the call.
+typedef void (*AdcCaptureCallback_t)(const AdcCapture_t*);
+
+/// @brief ADC capture configuration struct
+typedef struct
+{
+    AdcChannel_t channel;           //!< A channel on the same pin on all three ADCs, i.e. 0 to 3 or 10 to 13.
+    AdcResolution_t resolution;     //!< Resolution of the capture.
+    uint16_t* pBuffer;              //!< A 32-bit aligned circular buffer.
+    uint32_t bufferLength;          //!< Buffer length in samples. A multiple of 4 and at most
+                                    //!< ADC_CAPTURE_MAX_BUFFER_LENGTH.
+    uint32_t postTriggerLength;     //!< Minimum number of samples after the trigger, 1 to bufferLength / 2.
+    uint16_t lowThreshold;          //!< Results below this trigger the capture.
+    uint16_t highThreshold;         //!< Results above this trigger the capture. At most ADC_WATCHDOG_MAX_THRESHOLD.
+    AdcCaptureCallback_t Callback;  //!< A callback for passing the finished capture.
+} AdcCaptureConfig_t;
+
 //-----------------------------------------------------------------------------------------------------------------------------
 // Function Prototypes
 //-----------------------------------------------------------------------------------------------------------------------------
@@ -72,9 +220,95 @@ typedef struct
 /// @param pConfig - A pointer to the configuration struct.
 void HalAdc_SetConfiguration(const AdcConfig_t* pConfig);
 
-/// @brief This function starts a conversion of a given channel.
+/// @brief This function starts a conversion of a given channel. The result is passed to the channel callback from the
+/// ADC interrupt. Only one conversion may run at a time.
 /// @param channel - A channel to convert.
 /// @return Returns a corresponding error code. See types.h.
 Error_t HalAdc_StartConversion(AdcChannel_t channel);
 
+/// @brief This function sets the injected sequence. The injected conversions use the resolution of the regular
+/// conversions, which is 12-bit unless a conversion, scan or capture has set it otherwise. The sequence cannot be
+/// changed while it is converted.
+/// @param pConfig - A pointer to the injected sequence configuration. The configuration is not used after the function
+/// returns.
+/// @return Returns a corresponding error code. See types.h.
+Error_t HalAdc_SetInjectedConfiguration(const AdcInjectedConfig_t* pConfig);
+
+/// @brief This function starts a conversion of the injected sequence. It may be started during a single conversion or a
+/// scan, which are suspended for the time of the sequence. The results are passed to the callbacks of the channels in
+/// the sequence order from the ADC interrupt.
+/// @return Returns a corresponding error code. See types.h.
+Error_t HalAdc_StartInjectedConversion(void);
+
+/// @brief This function starts a scan of given channels into a circular buffer. The block callback is called
+/// from the DMA interrupt with the half of the buffer that has just been filled. The block stays valid until the DMA
+/// wraps around to it, i.e. for the time of one block. Single conversions cannot be started while a scan runs.
+/// Without a buffer, the blocks are lent from the pool of the driver instead. A lent block stays valid until it is
+/// released with HalAdc_ReleaseBlock(), and a block completed while all the other blocks are lent is dropped. The scan
+/// needs two free blocks to start.
+/// @param pConfig - A pointer to the scan configuration. The configuration is not used after the function returns.
+/// @return Returns a corresponding error code. See types.h.
+Error_t HalAdc_StartScan(const AdcScanConfig_t* pConfig);
+
+/// @brief This function stops a running scan. The blocks lent from the pool stay valid until they are released.
+/// @return Returns a corresponding error code. See types.h.
+Error_t HalAdc_StopScan(void);
+
+/// @brief This function returns a block lent by a scan to the pool. It may be called from any context, also after the
+/// scan has been stopped.
+/// @param pBlock - A pointer to the block passed to the block callback.
+/// @return Returns a corresponding error code. See types.h.
+Error_t HalAdc_ReleaseBlock(const uint16_t* pBlock);
+
+/// @brief This function returns the number of pool blocks dropped because all the other blocks were lent.
+/// @return Returns the number of dropped blocks since the start-up.
+uint32_t HalAdc_GetDroppedBlocks(void);
+
+/// @brief This function arms the analog watchdog on a channel. The callback is called from the ADC interrupt with the
+/// first result of the channel outside the window, after which the watchdog is disarmed. The thresholds are compared
+/// with the right-aligned results, so they are given in the scale of the resolution in use. The result is read from
+/// the data register, so in a scan of several channels it is reliable only if the guarded channel is the last one in
+/// the sequence.
+/// @param pConfig - A pointer to the watchdog configuration. The configuration is not used after the function returns.
+/// @return Returns a corresponding error code. See types.h.
+Error_t HalAdc_EnableWatchdog(const AdcWatchdogConfig_t* pConfig);
+
+/// @brief This function disarms the analog watchdog.
+void HalAdc_DisableWatchdog(void);
+
+/// @brief This function arms a capture. ADC1, ADC2 and ADC3 convert the channel interleaved and continuously into the
+/// circular buffer until the capture is triggered and then at least postTriggerLength samples more. The capture ends
+/// at the next half of the buffer after that, and the callback is called from the DMA interrupt with the buffer, which
+/// is owned by the caller again. The thresholds are given in the same scale as for HalAdc_EnableWatchdog(). The trigger
+/// index is accurate to the ADC interrupt latency. Nothing else can run on the ADCs during a capture.
+/// @param pConfig - A pointer to the capture configuration. The configuration is not used after the function returns.
+/// @return Returns a corresponding error code. See types.h.
+Error_t HalAdc_StartCapture(const AdcCaptureConfig_t* pConfig);
+
+/// @brief This function triggers an armed capture by software.
+/// @return Returns a corresponding error code. See types.h.
+Error_t HalAdc_TriggerCapture(void);
+
+/// @brief This function aborts a capture without calling the callback.
+/// @return Returns a corresponding error code. See types.h.
+Error_t HalAdc_StopCapture(void);
+
+/// @brief This function gets the conversion time of a channel.
+/// @param resolution - A resolution.
+/// @param sampleTime - A sample time.
+/// @return Returns the conversion time in ADC clock cycles. The ADC clock is PCLK2 / 4.
+uint32_t HalAdc_GetConversionCycles(AdcResolution_t resolution, AdcSampleTime_t sampleTime);
+
+/// @brief This function gets the worst-case latency from a conversion start to its callback. It includes the
+/// conversion time and the interrupt latency. The DWT cycle counter must be enabled, see Scheduler_Init().
+/// @return Returns the longest measured latency in CPU cycles.
+uint32_t HalAdc_GetMaxLatencyCycles(void);
+
+/// @brief The ADC interrupt handler that passes the conversion results, the injected results and the watchdog events to
+/// the callbacks and triggers the capture.
+void ADC_IRQHandler(void);
+
+/// @brief The DMA interrupt handler that passes the filled scan blocks to the block callback and ends the capture.
+void DMA2_Stream0_IRQHandler(void);
+
 #endif // ADC_H
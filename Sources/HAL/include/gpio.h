@@ -115,6 +115,84 @@ typedef struct
     GpioAf_t alternateFunction;     //!< Alternate function selector. No effect if alternate function mode is not enabled.
 } GpioConfig_t;
 
+#define GPIO_AF_REGISTER_COUNT      2U      //!< Number of alternate function registers, AFRL and AFRH.
+
+/// @brief This is the GPIO port configuration struct. It holds the configuration register fields of the configured
+/// pins of a port: each mask selects the fields of the pins and each value holds the new fields. The fields of the
+/// other pins are kept. See GPIO_PORT_CONFIG() for creating the struct at compile time.
+typedef struct
+{
+    GpioPort_t port;                                //!< GPIO port to be configured.
+    uint32_t modeMask;                              //!< MODER fields.
+    uint32_t mode;                                  //!< MODER values.
+    uint32_t openDrainMask;                         //!< OTYPER bits.
+    uint32_t openDrain;                             //!< OTYPER values.
+    uint32_t speedMask;                             //!< OSPEEDR fields.
+    uint32_t speed;                                 //!< OSPEEDR values.
+    uint32_t pullMask;                              //!< PUPDR fields.
+    uint32_t pull;                                  //!< PUPDR values.
+    uint32_t aAfMasks[GPIO_AF_REGISTER_COUNT];      //!< AFRL and AFRH fields.
+    uint32_t aAfs[GPIO_AF_REGISTER_COUNT];          //!< AFRL and AFRH values.
+} GpioPortConfig_t;
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Helper Macros
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief This macro creates the configuration of a port from a pin map at compile time, so that a board pin map
+/// becomes a constant table of register fields and configuring the board takes no per-pin work at run-time.
+/// A pin map is a macro that passes each pin to an entry macro with the parameters of GpioConfig_t in order. With the
+/// line continuations omitted:
+/// @code
+/// #define BOARD_PIN_MAP(ENTRY_, port_)
+///     ENTRY_(port_, portA, 9U, alternate, false, veryHigh, floating, af7)
+///     ENTRY_(port_, portC, 5U, output, true, low, floating, af0)
+///
+/// static const GpioPortConfig_t aBoardPorts[] = {GPIO_PORT_CONFIG(BOARD_PIN_MAP, portA),
+///                                                GPIO_PORT_CONFIG(BOARD_PIN_MAP, portC)};
+/// @endcode
+/// The pin numbers shall be constants from 0 to 15. A pin shall appear in the map once.
+/// @param pinMap_ - A pin map macro.
+/// @param port_ - The port whose pins are collected from the pin map.
+#define GPIO_PORT_CONFIG(pinMap_, port_) \
+{ \
+    .port = (port_), \
+    .modeMask = (uint32_t)(0UL pinMap_(GPIO_MODE_MASK_, (port_))), \
+    .mode = (uint32_t)(0UL pinMap_(GPIO_MODE_FIELD_, (port_))), \
+    .openDrainMask = (uint32_t)(0UL pinMap_(GPIO_OPEN_DRAIN_MASK_, (port_))), \
+    .openDrain = (uint32_t)(0UL pinMap_(GPIO_OPEN_DRAIN_FIELD_, (port_))), \
+    .speedMask = (uint32_t)(0UL pinMap_(GPIO_MODE_MASK_, (port_))), \
+    .speed = (uint32_t)(0UL pinMap_(GPIO_SPEED_FIELD_, (port_))), \
+    .pullMask = (uint32_t)(0UL pinMap_(GPIO_MODE_MASK_, (port_))), \
+    .pull = (uint32_t)(0UL pinMap_(GPIO_PULL_FIELD_, (port_))), \
+    .aAfMasks = {(uint32_t)(0UL pinMap_(GPIO_AFRL_MASK_, (port_))), (uint32_t)(0UL pinMap_(GPIO_AFRH_MASK_, (port_)))}, \
+    .aAfs = {(uint32_t)(0UL pinMap_(GPIO_AFRL_FIELD_, (port_))), (uint32_t)(0UL pinMap_(GPIO_AFRH_FIELD_, (port_)))} \
+}
+
+// Entry macros of GPIO_PORT_CONFIG(). Each adds a register field of a pin if the pin is in the collected port. MODER,
+// OSPEEDR and PUPDR have 2-bit fields, so they share the mask.
+#define GPIO_IF_PORT_(port_, pinPort_, field_)  | (((pinPort_) == (port_)) ? (uint32_t)(field_) : 0UL)
+#define GPIO_MODE_MASK_(port_, pinPort_, number_, mode_, isOpenDrain_, speed_, pull_, af_) \
+    GPIO_IF_PORT_((port_), (pinPort_), 0x3UL << (2U * (number_)))
+#define GPIO_MODE_FIELD_(port_, pinPort_, number_, mode_, isOpenDrain_, speed_, pull_, af_) \
+    GPIO_IF_PORT_((port_), (pinPort_), (uint32_t)(mode_) << (2U * (number_)))
+#define GPIO_OPEN_DRAIN_MASK_(port_, pinPort_, number_, mode_, isOpenDrain_, speed_, pull_, af_) \
+    GPIO_IF_PORT_((port_), (pinPort_), 0x1UL << (number_))
+#define GPIO_OPEN_DRAIN_FIELD_(port_, pinPort_, number_, mode_, isOpenDrain_, speed_, pull_, af_) \
+    GPIO_IF_PORT_((port_), (pinPort_), ((isOpenDrain_) ? 0x1UL : 0UL) << (number_))
+#define GPIO_SPEED_FIELD_(port_, pinPort_, number_, mode_, isOpenDrain_, speed_, pull_, af_) \
+    GPIO_IF_PORT_((port_), (pinPort_), (uint32_t)(speed_) << (2U * (number_)))
+#define GPIO_PULL_FIELD_(port_, pinPort_, number_, mode_, isOpenDrain_, speed_, pull_, af_) \
+    GPIO_IF_PORT_((port_), (pinPort_), (uint32_t)(pull_) << (2U * (number_)))
+#define GPIO_AFRL_MASK_(port_, pinPort_, number_, mode_, isOpenDrain_, speed_, pull_, af_) \
+    GPIO_IF_PORT_((port_), (pinPort_), ((number_) < 8U) ? (0xFUL << (4U * ((number_) % 8U))) : 0UL)
+#define GPIO_AFRH_MASK_(port_, pinPort_, number_, mode_, isOpenDrain_, speed_, pull_, af_) \
+    GPIO_IF_PORT_((port_), (pinPort_), ((number_) >= 8U) ? (0xFUL << (4U * ((number_) % 8U))) : 0UL)
+#define GPIO_AFRL_FIELD_(port_, pinPort_, number_, mode_, isOpenDrain_, speed_, pull_, af_) \
+    GPIO_IF_PORT_((port_), (pinPort_), ((number_) < 8U) ? ((uint32_t)(af_) << (4U * ((number_) % 8U))) : 0UL)
+#define GPIO_AFRH_FIELD_(port_, pinPort_, number_, mode_, isOpenDrain_, speed_, pull_, af_) \
+    GPIO_IF_PORT_((port_), (pinPort_), ((number_) >= 8U) ? ((uint32_t)(af_) << (4U * ((number_) % 8U))) : 0UL)
+
 //-----------------------------------------------------------------------------------------------------------------------------
 // Function Prototypes
 //-----------------------------------------------------------------------------------------------------------------------------
@@ -128,11 +206,31 @@ void HalGpio_GetConfiguration(GpioConfig_t* pGpio);
 /// @param pGpio - A pointer to a GPIO configuration struct.
 void HalGpio_SetConfiguration(const GpioConfig_t* pGpio);
 
+/// @brief This function sets the configurations of several pins. The pins are grouped by port, and each configuration
+/// register of a port is read and written once for all its pins, so the result equals calling
+/// HalGpio_SetConfiguration() for each pin in order. Nothing is configured if any of the pins is invalid.
+/// @param pGpios - A pointer to an array of GPIO configuration structs.
+/// @param pinCount - Number of configurations in the array.
+void HalGpio_SetConfigurationArray(const GpioConfig_t* pGpios, uint32_t pinCount);
+
+/// @brief This function sets the configurations of ports, typically a constant table created with GPIO_PORT_CONFIG().
+/// Each configuration register of a port is read and written once, with no per-pin work.
+/// @param pConfigs - A pointer to an array of GPIO port configuration structs.
+/// @param portCount - Number of port configurations in the array.
+void HalGpio_SetPortConfigurations(const GpioPortConfig_t* pConfigs, uint32_t portCount);
+
 /// @brief This function sets the output state of the given pin.
 /// @param pPin - A pointer to the pin selector.
 /// @param state - A new pin state.
 void HalGpio_SetOutputState(const GpioPin_t* pPin, bool state);
 
+/// @brief This function sets the output states of the masked pins of a port at once. The pins outside the mask keep
+/// their states, so the function is safe to use on ports shared with other modules.
+/// @param port - The port to be written.
+/// @param mask - A mask of the pins to be written, where bit 0 is pin 0.
+/// @param value - New states of the masked pins, where bit 0 is pin 0.
+void HalGpio_WritePortMasked(GpioPort_t port, uint16_t mask, uint16_t value);
+
 /// @brief This function gets the input state of the given pin.
 /// @param pPin - A pointer to the pin selector.
 /// @return The state of the pin input.
@@ -42,6 +42,19 @@ extern "C" {
 
 FAKE_VOID_FUNC(HalAdc_SetConfiguration, const AdcConfig_t*);
 FAKE_VALUE_FUNC(Error_t, HalAdc_StartConversion, AdcChannel_t);
+FAKE_VALUE_FUNC(Error_t, HalAdc_SetInjectedConfiguration, const AdcInjectedConfig_t*);
+FAKE_VALUE_FUNC(Error_t, HalAdc_StartInjectedConversion);
+FAKE_VALUE_FUNC(Error_t, HalAdc_StartScan, const AdcScanConfig_t*);
+FAKE_VALUE_FUNC(Error_t, HalAdc_StopScan);
+FAKE_VALUE_FUNC(Error_t, HalAdc_ReleaseBlock, const uint16_t*);
+FAKE_VALUE_FUNC(uint32_t, HalAdc_GetDroppedBlocks);
+FAKE_VALUE_FUNC(Error_t, HalAdc_EnableWatchdog, const AdcWatchdogConfig_t*);
+FAKE_VOID_FUNC(HalAdc_DisableWatchdog);
+FAKE_VALUE_FUNC(Error_t, HalAdc_StartCapture, const AdcCaptureConfig_t*);
+FAKE_VALUE_FUNC(Error_t, HalAdc_TriggerCapture);
+FAKE_VALUE_FUNC(Error_t, HalAdc_StopCapture);
+FAKE_VALUE_FUNC(uint32_t, HalAdc_GetConversionCycles, AdcResolution_t, AdcSampleTime_t);
+FAKE_VALUE_FUNC(uint32_t, HalAdc_GetMaxLatencyCycles);
 
 //-----------------------------------------------------------------------------------------------------------------------------
 // Helper Macros
@@ -51,6 +64,19 @@ FAKE_VALUE_FUNC(Error_t, HalAdc_StartConversion, AdcChannel_t);
 { \
     RESET_FAKE(HalAdc_SetConfiguration); \
     RESET_FAKE(HalAdc_StartConversion); \
+    RESET_FAKE(HalAdc_SetInjectedConfiguration); \
+    RESET_FAKE(HalAdc_StartInjectedConversion); \
+    RESET_FAKE(HalAdc_StartScan); \
+    RESET_FAKE(HalAdc_StopScan); \
+    RESET_FAKE(HalAdc_ReleaseBlock); \
+    RESET_FAKE(HalAdc_GetDroppedBlocks); \
+    RESET_FAKE(HalAdc_EnableWatchdog); \
+    RESET_FAKE(HalAdc_DisableWatchdog); \
+    RESET_FAKE(HalAdc_StartCapture); \
+    RESET_FAKE(HalAdc_TriggerCapture); \
+    RESET_FAKE(HalAdc_StopCapture); \
+    RESET_FAKE(HalAdc_GetConversionCycles); \
+    RESET_FAKE(HalAdc_GetMaxLatencyCycles); \
 }
 
 #endif // ADC_MOCK_H
@@ -42,7 +42,10 @@ extern "C" {
 
 FAKE_VOID_FUNC(HalGpio_GetConfiguration, GpioConfig_t*);
 FAKE_VOID_FUNC(HalGpio_SetConfiguration, const GpioConfig_t*);
+FAKE_VOID_FUNC(HalGpio_SetConfigurationArray, const GpioConfig_t*, uint32_t);
+FAKE_VOID_FUNC(HalGpio_SetPortConfigurations, const GpioPortConfig_t*, uint32_t);
 FAKE_VOID_FUNC(HalGpio_SetOutputState, const GpioPin_t*, bool);
+FAKE_VOID_FUNC(HalGpio_WritePortMasked, GpioPort_t, uint16_t, uint16_t);
 FAKE_VALUE_FUNC(bool, HalGpio_GetInputState, const GpioPin_t*);
 FAKE_VALUE_FUNC(bool, HalGpio_GetOutputState, const GpioPin_t*);
 
@@ -54,7 +57,10 @@ FAKE_VALUE_FUNC(bool, HalGpio_GetOutputState, const GpioPin_t*);
 { \
     RESET_FAKE(HalGpio_GetConfiguration); \
     RESET_FAKE(HalGpio_SetConfiguration); \
+    RESET_FAKE(HalGpio_SetConfigurationArray); \
+    RESET_FAKE(HalGpio_SetPortConfigurations); \
     RESET_FAKE(HalGpio_SetOutputState); \
+    RESET_FAKE(HalGpio_WritePortMasked); \
     RESET_FAKE(HalGpio_GetInputState); \
     RESET_FAKE(HalGpio_GetOutputState); \
 }
@@ -0,0 +1,1124 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2020 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    adc.c
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    17 Oct 2026
+//! 
+//! @brief   This is an example of an ADC HAL module.
+//! Conversions run on ADC1 one channel at a time. A conversion is started with a software trigger and the end of
+//! conversion interrupt reads the result and passes it to the callback of the channel. Each channel keeps its own
+//! resolution and sample time, so both are programmed when a conversion starts.
+//! A scan converts a sequence of channels continuously, and DMA2 Stream0 moves the results into a circular buffer. The
+//! half transfer and transfer complete interrupts pass each half of the buffer to the block callback, so the CPU load
+//! per sample is a share of two interrupts per buffer. A scan is either continuous or started by the TRGO output of a
+//! timer on every update event, in which case the driver runs the timer at the scan rate.
+//! A scan without a buffer runs in the DMA double buffer mode on blocks of the driver's pool. Each completed block is
+//! lent to the block callback, and the stream is given a free block in its place, so the block stays with the consumer
+//! until it is released. If no block is free, the completed block is dropped and filled again.
+//! A capture runs ADC1, ADC2 and ADC3 in the triple interleaved mode on one channel. Each ADC starts its conversion
+//! five ADC clock cycles after the previous one, and DMA mode 2 moves the results of two conversions per transfer from
+//! the common data register into a circular buffer. The analog watchdogs of the three ADCs or software trigger the
+//! capture, and the DMA is stopped at the first buffer half boundary that leaves enough samples after the trigger.
+//! The analog watchdog shares the ADC interrupt. It is disarmed in the interrupt on the first result outside the window,
+//! since the result usually stays outside and would otherwise interrupt every conversion.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include "adc.h"
+#include "hal.h"
+#include "utils.h"
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Defines and Macros
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#define HAL_ADC                         ADC1    //!< The ADC peripheral of the driver.
+
+#define RESOLUTION_MASK                 (ADC_CR1_RES_Msk >> ADC_CR1_RES_Pos)
+#define SEQUENCE_LENGTH_MASK            (ADC_SQR1_L_Msk >> ADC_SQR1_L_Pos)
+#define SEQUENCE_CHANNEL_MASK           (ADC_SQR3_SQ1_Msk >> ADC_SQR3_SQ1_Pos)
+#define BITS_IN_SEQUENCE_CHANNEL        (ADC_SQR3_SQ2_Pos)
+#define WATCHDOG_CHANNEL_MASK           (ADC_CR1_AWDCH_Msk >> ADC_CR1_AWDCH_Pos)
+#define SQR3_CHANNELS                   6U      //!< Conversions 1 to 6 are in SQR3.
+#define SQR2_CHANNELS                   6U      //!< Conversions 7 to 12 are in SQR2, the rest in SQR1.
+#define PRESCALER_MASK                  (ADC_CCR_ADCPRE_Msk >> ADC_CCR_ADCPRE_Pos)
+#define SAMPLE_TIME_MASK                (ADC_SMPR2_SMP0_Msk >> ADC_SMPR2_SMP0_Pos)
+#define BITS_IN_SAMPLE_TIME             (ADC_SMPR2_SMP1_Pos)
+#define SMPR1_FIRST_CHANNEL             10U     //!< Channels from 10 up are in SMPR1, the lower ones in SMPR2.
+#define INJECTED_LENGTH_MASK            (ADC_JSQR_JL_Msk >> ADC_JSQR_JL_Pos)
+#define INJECTED_CHANNEL_MASK           (ADC_JSQR_JSQ1_Msk >> ADC_JSQR_JSQ1_Pos)
+#define BITS_IN_INJECTED_CHANNEL        (ADC_JSQR_JSQ2_Pos)
+
+#define PRESCALER_DIV_4                 1UL     //!< PCLK2 / 4 keeps the ADC clock below 36 MHz at any PCLK2.
+#define CPU_CYCLES_PER_ADC_CYCLE        8UL     //!< At most, i.e. PCLK2 / 4 with the APB2 prescaler at 2.
+
+#define HAL_DMA                         DMA2            //!< The DMA controller of the scan.
+#define HAL_DMA_STREAM                  DMA2_Stream0    //!< The DMA stream of the scan. ADC1 is on its channel 0.
+#define EXTSEL_TIM2_TRGO                6UL     //!< External trigger selections. See reference manual chapter 13.13.3.
+#define EXTSEL_TIM3_TRGO                8UL
+#define EXTSEL_TIM8_TRGO                14UL
+#define EXTEN_RISING_EDGE               1UL
+#define EXTSEL_MASK                     (ADC_CR2_EXTSEL_Msk >> ADC_CR2_EXTSEL_Pos)
+#define EXTEN_MASK                      (ADC_CR2_EXTEN_Msk >> ADC_CR2_EXTEN_Pos)
+
+#define TIMER_MMS_UPDATE                2UL     //!< TRGO is the update event.
+#define TIMER_MMS_MASK                  (TIM_CR2_MMS_Msk >> TIM_CR2_MMS_Pos)
+#define TIMER_PRESCALER_RANGE           0x10000UL   //!< Prescaler and auto-reload range of the 16-bit timers.
+#define TIMER_MIN_PERIOD                2UL     //!< The shortest timer period in timer clock cycles.
+#define APB_PRESCALER_DIV_2             4UL     //!< The first APB prescaler selection that divides HCLK.
+#define APB_PRESCALER_MASK              (RCC_CFGR_PPRE1_Msk >> RCC_CFGR_PPRE1_Pos)
+
+#define CAPTURE_ADC_COUNT               3U      //!< A capture runs ADC1, ADC2 and ADC3.
+#define MULTI_MODE_INDEPENDENT          0UL     //!< Multi-ADC mode selections. See reference manual chapter 13.13.16.
+#define MULTI_MODE_TRIPLE_INTERLEAVED   0x17UL
+#define MULTI_MODE_MASK                 (ADC_CCR_MULTI_Msk >> ADC_CCR_MULTI_Pos)
+#define INTERLEAVE_DELAY_5_CYCLES       0UL     //!< The shortest delay between the sampling phases.
+#define INTERLEAVE_DELAY_MASK           (ADC_CCR_DELAY_Msk >> ADC_CCR_DELAY_Pos)
+#define MULTI_DMA_MODE_2                2UL     //!< Two half-word results per DMA request.
+#define MULTI_DMA_MODE_MASK             (ADC_CCR_DMA_Msk >> ADC_CCR_DMA_Pos)
+
+#define DMA_PRIORITY_HIGH               2UL
+#define DMA_SIZE_HALF_WORD              1UL
+#define DMA_SIZE_WORD                   2UL
+#define SAMPLES_PER_CAPTURE_TRANSFER    2UL     //!< DMA mode 2 transfers two results in a word.
+
+//! DMA stream configuration of the scan: channel 0, peripheral to memory, 16-bit transfers to an incremented memory
+//! address in circular mode, high priority, and half transfer, transfer complete and transfer error interrupts.
+#define DMA_SCAN_CONFIGURATION          ((DMA_PRIORITY_HIGH << DMA_SxCR_PL_Pos) | \
+                                         (DMA_SIZE_HALF_WORD << DMA_SxCR_MSIZE_Pos) | \
+                                         (DMA_SIZE_HALF_WORD << DMA_SxCR_PSIZE_Pos) | \
+                                         DMA_SxCR_MINC | DMA_SxCR_CIRC | DMA_SxCR_HTIE | DMA_SxCR_TCIE | DMA_SxCR_TEIE)
+
+//! DMA stream configuration of a scan into the pool: as in the scan, but in the double buffer mode with a transfer
+//! complete interrupt per block.
+#define DMA_POOL_CONFIGURATION          ((DMA_PRIORITY_HIGH << DMA_SxCR_PL_Pos) | \
+                                         (DMA_SIZE_HALF_WORD << DMA_SxCR_MSIZE_Pos) | \
+                                         (DMA_SIZE_HALF_WORD << DMA_SxCR_PSIZE_Pos) | \
+                                         DMA_SxCR_MINC | DMA_SxCR_DBM | DMA_SxCR_TCIE | DMA_SxCR_TEIE)
+#define DMA_MEMORY_COUNT                2U      //!< The double buffer mode alternates between M0AR and M1AR.
+
+//! DMA stream configuration of the capture: as in the scan, but with 32-bit transfers of two results each.
+#define DMA_CAPTURE_CONFIGURATION       ((DMA_PRIORITY_HIGH << DMA_SxCR_PL_Pos) | \
+                                         (DMA_SIZE_WORD << DMA_SxCR_MSIZE_Pos) | \
+                                         (DMA_SIZE_WORD << DMA_SxCR_PSIZE_Pos) | \
+                                         DMA_SxCR_MINC | DMA_SxCR_CIRC | DMA_SxCR_HTIE | DMA_SxCR_TCIE | DMA_SxCR_TEIE)
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Typedefs
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief The owner of a pool block.
+typedef enum
+{
+    BLOCK_FREE = 0,     //!< The block is in the pool.
+    BLOCK_DMA,          //!< The DMA stream fills the block.
+    BLOCK_LENT          //!< The block has been lent to the consumer.
+} BlockState_t;
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Static Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+staticv AdcCallback_t aCallbacks[ADC_CHANNEL_COUNT];        //!< Result callbacks per channel. NULL if not configured.
+staticv AdcResolution_t aResolutions[ADC_CHANNEL_COUNT];    //!< Resolutions per channel.
+staticv AdcSampleTime_t aSampleTimes[ADC_CHANNEL_COUNT];    //!< Sample times per channel.
+
+/// @brief Sample times in ADC clock cycles. See STM32F429ZI reference manual chapter 13.13.4.
+staticv const uint16_t aSampleCycles[ADC_SAMPLE_TIME_COUNT] = {3U, 15U, 28U, 56U, 84U, 112U, 144U, 480U};
+staticv volatile bool isConverting = false;                 //!< A flag indicating that a conversion is running.
+staticv volatile AdcChannel_t activeChannel = ADC_CHANNEL_0;    //!< The channel of the running conversion.
+staticv volatile uint32_t startCycles = 0UL;                //!< The cycle counter at the conversion start.
+staticv volatile uint32_t maxLatencyCycles = 0UL;           //!< The longest conversion start to callback time.
+staticv volatile bool isScanning = false;                   //!< A flag indicating that a scan is running.
+staticv const uint16_t* pScanBuffer = NULL;                 //!< The circular buffer of the scan.
+staticv uint32_t scanBlockLength = 0UL;                     //!< Length of a half of the scan buffer in samples.
+staticv AdcBlockCallback_t ScanCallback = NULL;             //!< The block callback of the scan.
+staticv TIM_TypeDef* pTriggerTimer = NULL;                  //!< The trigger timer of the scan. NULL if continuous.
+staticv volatile bool isLending = false;                    //!< A flag indicating that a scan runs into the pool.
+staticv uint16_t aBlockPool[ADC_POOL_BLOCK_COUNT][ADC_POOL_BLOCK_LENGTH];   //!< The blocks lent by the driver.
+staticv volatile BlockState_t aBlockStates[ADC_POOL_BLOCK_COUNT];           //!< Owners of the pool blocks.
+staticv uint32_t aDmaBlocks[DMA_MEMORY_COUNT];              //!< Pool blocks of M0AR and M1AR.
+staticv volatile uint32_t droppedBlocks = 0UL;              //!< Number of blocks dropped for lack of a free block.
+staticv volatile bool isWatchdogArmed = false;              //!< A flag indicating that the analog watchdog is armed.
+staticv AdcCallback_t WatchdogCallback = NULL;              //!< The callback of the analog watchdog.
+staticv AdcCallback_t aInjectedCallbacks[ADC_INJECTED_MAX_CHANNELS];  //!< Result callbacks of the injected sequence.
+staticv uint32_t injectedChannelCount = 0UL;                //!< Length of the injected sequence. 0 if not configured.
+staticv volatile bool isInjectedConverting = false;         //!< A flag indicating that an injected sequence is running.
+staticv volatile bool isCapturing = false;                  //!< A flag indicating that a capture is armed or running.
+staticv volatile bool isCaptureTriggered = false;           //!< A flag indicating that the capture has been triggered.
+staticv const uint16_t* pCaptureBuffer = NULL;              //!< The circular buffer of the capture.
+staticv uint32_t captureLength = 0UL;                       //!< Length of the capture buffer in samples.
+staticv uint32_t capturePostLength = 0UL;                   //!< Minimum number of samples after the trigger.
+staticv uint32_t captureTriggerIndex = 0UL;                 //!< Buffer index of the trigger.
+staticv uint32_t captureStopIndex = 0UL;                    //!< The half boundary at which the capture ends.
+staticv AdcCaptureCallback_t CaptureCallback = NULL;        //!< The callback of the capture.
+
+//! The ADCs of the capture. ADC1 is the master of the triple mode.
+staticv ADC_TypeDef* const apCaptureAdcs[CAPTURE_ADC_COUNT] = {ADC1, ADC2, ADC3};
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Static Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief This function enables the ADC clock, the ADC and its end of conversion interrupt.
+staticf void HalAdc_Enable(void);
+
+/// @brief This function sets the sample time of a channel.
+/// @param pAdc - A pointer to the ADC.
+/// @param channel - A channel to configure.
+/// @param sampleTime - A sample time.
+staticf void HalAdc_SetSampleTime(ADC_TypeDef* pAdc, AdcChannel_t channel, AdcSampleTime_t sampleTime);
+
+/// @brief This function sets a channel to a position of the regular sequence.
+/// @param pAdc - A pointer to the ADC.
+/// @param rank - Position in the sequence starting from 0.
+/// @param channel - A channel to convert at the position.
+staticf void HalAdc_SetSequenceChannel(ADC_TypeDef* pAdc, uint32_t rank, AdcChannel_t channel);
+
+/// @brief This function checks a scan configuration.
+/// @param pConfig - A pointer to the scan configuration.
+/// @return Returns true if the configuration is valid, false otherwise.
+staticf bool HalAdc_IsScanConfigValid(const AdcScanConfig_t* pConfig);
+
+/// @brief This function checks an injected sequence configuration.
+/// @param pConfig - A pointer to the injected sequence configuration.
+/// @return Returns true if the configuration is valid, false otherwise.
+staticf bool HalAdc_IsInjectedConfigValid(const AdcInjectedConfig_t* pConfig);
+
+/// @brief This function reads the result of an injected conversion.
+/// @param rank - Position in the injected sequence starting from 0.
+/// @return Returns the result.
+staticf uint16_t HalAdc_ReadInjectedResult(uint32_t rank);
+
+/// @brief This function sets the analog watchdog window of an ADC on a single channel and clears an old watchdog event.
+/// @param pAdc - A pointer to the ADC.
+/// @param channel - A guarded channel.
+/// @param lowThreshold - Results below this are outside the window.
+/// @param highThreshold - Results above this are outside the window.
+staticf void HalAdc_SetWatchdogWindow(ADC_TypeDef* pAdc, AdcChannel_t channel, uint16_t lowThreshold,
+                                      uint16_t highThreshold);
+
+/// @brief This function checks a capture configuration.
+/// @param pConfig - A pointer to the capture configuration.
+/// @return Returns true if the configuration is valid, false otherwise.
+staticf bool HalAdc_IsCaptureConfigValid(const AdcCaptureConfig_t* pConfig);
+
+/// @brief This function sets up the DMA stream into a circular buffer and enables it.
+/// @param peripheralAddress - Address of the data register.
+/// @param pBuffer - The circular buffer, or the first buffer in the double buffer mode.
+/// @param pSecondBuffer - The second buffer in the double buffer mode. NULL otherwise.
+/// @param transfers - Buffer length in DMA transfers.
+/// @param configuration - DMA stream configuration.
+staticf void HalAdc_StartDma(uint32_t peripheralAddress, uint16_t* pBuffer, uint16_t* pSecondBuffer, uint32_t transfers,
+                             uint32_t configuration);
+
+/// @brief This function takes a free block from the pool for the DMA stream.
+/// @return Returns the index of the block or ADC_POOL_BLOCK_COUNT if no block is free.
+staticf uint32_t HalAdc_AcquireBlock(void);
+
+/// @brief This function counts the free blocks of the pool.
+/// @return Returns the number of free blocks.
+staticf uint32_t HalAdc_CountFreeBlocks(void);
+
+/// @brief This function finds a block of the pool.
+/// @param pBlock - A pointer to the block.
+/// @return Returns the index of the block or ADC_POOL_BLOCK_COUNT if the pointer is not a pool block.
+staticf uint32_t HalAdc_FindBlock(const uint16_t* pBlock);
+
+/// @brief This function lends the block the DMA stream has just completed to the block callback and gives the stream a
+/// free block in its place.
+staticf void HalAdc_LendBlock(void);
+
+/// @brief This function gets the buffer index the DMA writes next.
+/// @param bufferLength - Buffer length in samples.
+/// @param samplesPerTransfer - Number of samples in a DMA transfer.
+/// @return Returns the index.
+staticf uint32_t HalAdc_GetDmaIndex(uint32_t bufferLength, uint32_t samplesPerTransfer);
+
+/// @brief This function triggers the running capture. It sets the half boundary at which the capture ends and disarms
+/// the analog watchdogs.
+staticf void HalAdc_SetCaptureTrigger(void);
+
+/// @brief This function stops the ADCs and the DMA stream of a capture and restores the independent mode.
+staticf void HalAdc_StopCaptureAdcs(void);
+
+/// @brief This function handles a half boundary of the capture buffer. It ends a triggered capture at its stop index
+/// and passes the capture to the callback.
+/// @param boundaryIndex - Buffer index of the boundary.
+staticf void HalAdc_HandleCaptureBoundary(uint32_t boundaryIndex);
+
+/// @brief This function selects the timer of a trigger source, enables its clock and sets the ADC external trigger.
+/// @param trigger - A timer trigger source.
+/// @return Returns a pointer to the timer.
+staticf TIM_TypeDef* HalAdc_SetTriggerTimer(AdcTrigger_t trigger);
+
+/// @brief This function starts a trigger timer with an update event at a given period.
+/// @param pTimer - A pointer to the timer.
+/// @param period - Timer clock cycles between two update events.
+staticf void HalAdc_StartTriggerTimer(TIM_TypeDef* pTimer, uint32_t period);
+
+/// @brief This function gets the clock frequency of the timer of a trigger source.
+/// @param trigger - A timer trigger source.
+/// @return Returns the timer clock frequency in Hz.
+staticf uint32_t HalAdc_GetTimerClock(AdcTrigger_t trigger);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Function Definitions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+void HalAdc_SetConfiguration(const AdcConfig_t* pConfig)
+{
+    UTILS_ASSERT_VOID((pConfig != NULL), HAL_ADC_FAILURE);
+    UTILS_ASSERT_VOID((pConfig->channel < ADC_CHANNEL_COUNT), HAL_ADC_FAILURE);
+    UTILS_ASSERT_VOID((pConfig->resolution <= ADC_RES_8_BIT), HAL_ADC_FAILURE);
+    UTILS_ASSERT_VOID((pConfig->sampleTime < ADC_SAMPLE_TIME_COUNT), HAL_ADC_FAILURE);
+    UTILS_ASSERT_VOID((pConfig->Callback != NULL), HAL_ADC_FAILURE);
+
+    HalAdc_Enable();
+    aResolutions[pConfig->channel] = pConfig->resolution;
+    aSampleTimes[pConfig->channel] = pConfig->sampleTime;
+    aCallbacks[pConfig->channel] = pConfig->Callback;
+    return;
+}
+
+Error_t HalAdc_StartConversion(AdcChannel_t channel)
+{
+    UTILS_ASSERT((channel < ADC_CHANNEL_COUNT), HAL_ADC_FAILURE, ERROR_INVALID_ACTION);
+    UTILS_ASSERT((aCallbacks[channel] != NULL), HAL_ADC_FAILURE, ERROR_INVALID_ACTION);
+
+    Error_t error;
+    if (isConverting || isScanning || isCapturing)
+    {
+        error = ERROR_RESOURCE_NOT_AVAILABLE;
+    }
+    else
+    {
+        isConverting = true;
+        activeChannel = channel;
+
+        // See STM32F429ZI reference manual chapters 13.13.2, 13.13.9 and 13.13.11. A scan or a capture may have changed
+        // the sample time of the channel. Only a single conversion is completed by the end of conversion interrupt, so
+        // the interrupt is enabled here instead of with the ADC.
+        SET_BITFIELD(HAL_ADC->CR1, ADC_CR1_RES_Pos, RESOLUTION_MASK, (uint32_t)aResolutions[channel]);
+        HalAdc_SetSampleTime(HAL_ADC, channel, aSampleTimes[channel]);
+        SET_BITFIELD(HAL_ADC->SQR1, ADC_SQR1_L_Pos, SEQUENCE_LENGTH_MASK, 0UL);
+        HalAdc_SetSequenceChannel(HAL_ADC, 0UL, channel);
+        SET_BIT(HAL_ADC->CR1, ADC_CR1_EOCIE_Pos);
+        startCycles = REG_READ(DWT->CYCCNT);
+        SET_BIT(HAL_ADC->CR2, ADC_CR2_SWSTART_Pos);
+        error = ERROR_OK;
+    }
+    return error;
+}
+
+Error_t HalAdc_SetInjectedConfiguration(const AdcInjectedConfig_t* pConfig)
+{
+    UTILS_ASSERT(HalAdc_IsInjectedConfigValid(pConfig), HAL_ADC_FAILURE, ERROR_INVALID_ACTION);
+
+    Error_t error;
+    if (isInjectedConverting)
+    {
+        error = ERROR_RESOURCE_NOT_AVAILABLE;
+    }
+    else
+    {
+        // See STM32F429ZI reference manual chapters 13.3.5 and 13.13.12. A sequence shorter than four conversions
+        // ends at JSQ4, while the results are stored from JDR1 on in the conversion order.
+        uint32_t firstPosition = ADC_INJECTED_MAX_CHANNELS - pConfig->channelCount;
+        uint32_t sequence = (pConfig->channelCount - 1UL) << ADC_JSQR_JL_Pos;
+        for (uint32_t rank = 0UL; rank < pConfig->channelCount; ++rank)
+        {
+            AdcChannel_t channel = pConfig->pChannels[rank].channel;
+            sequence |= ((uint32_t)channel & INJECTED_CHANNEL_MASK) << ((firstPosition + rank) * BITS_IN_INJECTED_CHANNEL);
+            HalAdc_SetSampleTime(HAL_ADC, channel, pConfig->pChannels[rank].sampleTime);
+            aInjectedCallbacks[rank] = pConfig->pChannels[rank].Callback;
+        }
+        injectedChannelCount = pConfig->channelCount;
+
+        // The end of conversion interrupt is left as it is, so that the configuration does not disturb a scan.
+        SET_BIT(RCC->APB2ENR, RCC_APB2ENR_ADC1EN_Pos);
+        SET_BITFIELD(ADC123_COMMON->CCR, ADC_CCR_ADCPRE_Pos, PRESCALER_MASK, PRESCALER_DIV_4);
+        REG_WRITE(HAL_ADC->JSQR, sequence);
+        SET_BIT(HAL_ADC->CR1, ADC_CR1_JEOCIE_Pos);
+        SET_BIT(HAL_ADC->CR2, ADC_CR2_ADON_Pos);
+        NVIC_EnableIRQ(ADC_IRQn);
+        error = ERROR_OK;
+    }
+    return error;
+}
+
+Error_t HalAdc_StartInjectedConversion(void)
+{
+    UTILS_ASSERT((injectedChannelCount > 0UL), HAL_ADC_FAILURE, ERROR_INVALID_ACTION);
+
+    Error_t error;
+    if (isInjectedConverting || isCapturing)
+    {
+        error = ERROR_RESOURCE_NOT_AVAILABLE;
+    }
+    else
+    {
+        // See STM32F429ZI reference manual chapters 13.3.4 and 13.3.5. The injected sequence suspends a running regular
+        // conversion, which resumes once the sequence has ended. The scan mode is needed for more than one injected
+        // conversion, and with a regular sequence of one it converts the single channel as before.
+        isInjectedConverting = true;
+        SET_BIT(HAL_ADC->CR1, ADC_CR1_SCAN_Pos);
+        REG_WRITE(HAL_ADC->SR, ~(uint32_t)ADC_SR_JEOC);
+        SET_BIT(HAL_ADC->CR2, ADC_CR2_JSWSTART_Pos);
+        error = ERROR_OK;
+    }
+    return error;
+}
+
+Error_t HalAdc_StartScan(const AdcScanConfig_t* pConfig)
+{
+    UTILS_ASSERT(HalAdc_IsScanConfigValid(pConfig), HAL_ADC_FAILURE, ERROR_INVALID_ACTION);
+
+    Error_t error;
+    if (isConverting || isScanning || isCapturing)
+    {
+        error = ERROR_RESOURCE_NOT_AVAILABLE;
+    }
+    else if ((pConfig->pBuffer == NULL) && (HalAdc_CountFreeBlocks() < DMA_MEMORY_COUNT))
+    {
+        // The consumer holds too many blocks.
+        error = ERROR_RESOURCE_NOT_AVAILABLE;
+    }
+    else
+    {
+        isScanning = true;
+        pScanBuffer = pConfig->pBuffer;
+        scanBlockLength = pConfig->bufferLength / 2UL;
+        ScanCallback = pConfig->Callback;
+
+        HalAdc_Enable();
+        if (pConfig->pBuffer == NULL)
+        {
+            isLending = true;
+            aDmaBlocks[0] = HalAdc_AcquireBlock();
+            aDmaBlocks[1] = HalAdc_AcquireBlock();
+            HalAdc_StartDma((uint32_t)(uintptr_t)&HAL_ADC->DR, aBlockPool[aDmaBlocks[0]], aBlockPool[aDmaBlocks[1]],
+                            scanBlockLength, DMA_POOL_CONFIGURATION);
+        }
+        else
+        {
+            HalAdc_StartDma((uint32_t)(uintptr_t)&HAL_ADC->DR, pConfig->pBuffer, NULL, pConfig->bufferLength,
+                            DMA_SCAN_CONFIGURATION);
+        }
+
+        // See STM32F429ZI reference manual chapters 13.8.1, 13.13.2, 13.13.3 and 13.13.9.
+        // The DMA takes the results, so the end of conversion interrupt is not needed.
+        CLEAR_BIT(HAL_ADC->CR1, ADC_CR1_EOCIE_Pos);
+        SET_BIT(HAL_ADC->CR1, ADC_CR1_SCAN_Pos);
+        SET_BITFIELD(HAL_ADC->CR1, ADC_CR1_RES_Pos, RESOLUTION_MASK, (uint32_t)pConfig->resolution);
+        SET_BITFIELD(HAL_ADC->SQR1, ADC_SQR1_L_Pos, SEQUENCE_LENGTH_MASK, pConfig->channelCount - 1UL);
+        for (uint32_t rank = 0UL; rank < pConfig->channelCount; ++rank)
+        {
+            HalAdc_SetSequenceChannel(HAL_ADC, rank, pConfig->pChannels[rank]);
+            HalAdc_SetSampleTime(HAL_ADC, pConfig->pChannels[rank], pConfig->sampleTime);
+        }
+        SET_BIT(HAL_ADC->CR2, ADC_CR2_DMA_Pos);
+        SET_BIT(HAL_ADC->CR2, ADC_CR2_DDS_Pos);
+        if (pConfig->trigger == ADC_TRIGGER_CONTINUOUS)
+        {
+            pTriggerTimer = NULL;
+            SET_BIT(HAL_ADC->CR2, ADC_CR2_CONT_Pos);
+            SET_BIT(HAL_ADC->CR2, ADC_CR2_SWSTART_Pos);
+        }
+        else
+        {
+            // Each trigger converts the sequence once, and the timer starts only after the ADC is ready.
+            CLEAR_BIT(HAL_ADC->CR2, ADC_CR2_CONT_Pos);
+            pTriggerTimer = HalAdc_SetTriggerTimer(pConfig->trigger);
+            HalAdc_StartTriggerTimer(pTriggerTimer, HalAdc_GetTimerClock(pConfig->trigger) / pConfig->scanRate);
+        }
+        error = ERROR_OK;
+    }
+    return error;
+}
+
+Error_t HalAdc_StopScan(void)
+{
+    Error_t error;
+    if (isScanning == false)
+    {
+        error = ERROR_INVALID_ACTION;
+    }
+    else
+    {
+        // Stopping the trigger or the continuous mode ends the scan after the running sequence, and disabling the DMA
+        // requests stops the transfers at once.
+        if (pTriggerTimer != NULL)
+        {
+            // TRGO is disconnected from the update event, so the update generation of the next start does not trigger a
+            // conversion.
+            CLEAR_BIT(pTriggerTimer->CR1, TIM_CR1_CEN_Pos);
+            SET_BITFIELD(pTriggerTimer->CR2, TIM_CR2_MMS_Pos, TIMER_MMS_MASK, 0UL);
+            SET_BITFIELD(HAL_ADC->CR2, ADC_CR2_EXTEN_Pos, EXTEN_MASK, 0UL);
+            pTriggerTimer = NULL;
+        }
+        CLEAR_BIT(HAL_ADC->CR2, ADC_CR2_CONT_Pos);
+        CLEAR_BIT(HAL_ADC->CR2, ADC_CR2_DDS_Pos);
+        CLEAR_BIT(HAL_ADC->CR2, ADC_CR2_DMA_Pos);
+        CLEAR_BIT(HAL_DMA_STREAM->CR, DMA_SxCR_EN_Pos);
+        NVIC_DisableIRQ(DMA2_Stream0_IRQn);
+        CLEAR_BIT(HAL_ADC->CR1, ADC_CR1_SCAN_Pos);
+        if (isLending)
+        {
+            // The lent blocks stay with the consumer until they are released.
+            aBlockStates[aDmaBlocks[0]] = BLOCK_FREE;
+            aBlockStates[aDmaBlocks[1]] = BLOCK_FREE;
+            isLending = false;
+        }
+        isScanning = false;
+        error = ERROR_OK;
+    }
+    return error;
+}
+
+Error_t HalAdc_ReleaseBlock(const uint16_t* pBlock)
+{
+    uint32_t block = HalAdc_FindBlock(pBlock);
+    UTILS_ASSERT((block < ADC_POOL_BLOCK_COUNT), HAL_ADC_FAILURE, ERROR_INVALID_ACTION);
+    UTILS_ASSERT((aBlockStates[block] == BLOCK_LENT), HAL_ADC_FAILURE, ERROR_INVALID_ACTION);
+
+    // Only the DMA interrupt takes free blocks and only the release returns lent ones, so no lock is needed.
+    aBlockStates[block] = BLOCK_FREE;
+    return ERROR_OK;
+}
+
+uint32_t HalAdc_GetDroppedBlocks(void)
+{
+    return droppedBlocks;
+}
+
+Error_t HalAdc_EnableWatchdog(const AdcWatchdogConfig_t* pConfig)
+{
+    UTILS_ASSERT((pConfig != NULL), HAL_ADC_FAILURE, ERROR_INVALID_ACTION);
+    UTILS_ASSERT((pConfig->channel < ADC_CHANNEL_COUNT), HAL_ADC_FAILURE, ERROR_INVALID_ACTION);
+    UTILS_ASSERT((pConfig->lowThreshold <= pConfig->highThreshold), HAL_ADC_FAILURE, ERROR_INVALID_ACTION);
+    UTILS_ASSERT((pConfig->highThreshold <= ADC_WATCHDOG_MAX_THRESHOLD), HAL_ADC_FAILURE, ERROR_INVALID_ACTION);
+    UTILS_ASSERT((pConfig->Callback != NULL), HAL_ADC_FAILURE, ERROR_INVALID_ACTION);
+
+    Error_t error;
+    if (isCapturing)
+    {
+        error = ERROR_RESOURCE_NOT_AVAILABLE;
+    }
+    else
+    {
+        // See STM32F429ZI reference manual chapters 13.3.7, 13.13.1, 13.13.2, 13.13.7 and 13.13.8. The end of
+        // conversion interrupt is left as it is, so the watchdog can be armed during a scan.
+        SET_BIT(RCC->APB2ENR, RCC_APB2ENR_ADC1EN_Pos);
+        WatchdogCallback = pConfig->Callback;
+        HalAdc_SetWatchdogWindow(HAL_ADC, pConfig->channel, pConfig->lowThreshold, pConfig->highThreshold);
+        isWatchdogArmed = true;
+        SET_BIT(HAL_ADC->CR1, ADC_CR1_AWDIE_Pos);
+        SET_BIT(HAL_ADC->CR1, ADC_CR1_AWDEN_Pos);
+        NVIC_EnableIRQ(ADC_IRQn);
+        error = ERROR_OK;
+    }
+    return error;
+}
+
+void HalAdc_DisableWatchdog(void)
+{
+    CLEAR_BIT(HAL_ADC->CR1, ADC_CR1_AWDEN_Pos);
+    CLEAR_BIT(HAL_ADC->CR1, ADC_CR1_AWDIE_Pos);
+    isWatchdogArmed = false;
+    return;
+}
+
+Error_t HalAdc_StartCapture(const AdcCaptureConfig_t* pConfig)
+{
+    UTILS_ASSERT(HalAdc_IsCaptureConfigValid(pConfig), HAL_ADC_FAILURE, ERROR_INVALID_ACTION);
+
+    Error_t error;
+    if (isConverting || isScanning || isCapturing || isWatchdogArmed || isInjectedConverting)
+    {
+        error = ERROR_RESOURCE_NOT_AVAILABLE;
+    }
+    else
+    {
+        isCapturing = true;
+        isCaptureTriggered = false;
+        pCaptureBuffer = pConfig->pBuffer;
+        captureLength = pConfig->bufferLength;
+        capturePostLength = pConfig->postTriggerLength;
+        CaptureCallback = pConfig->Callback;
+
+        // See STM32F429ZI reference manual chapters 13.9.3, 13.9.6 and 13.13.16. The DMA requests of the triple mode
+        // come through the stream of ADC1.
+        HalAdc_Enable();
+        SET_BIT(RCC->APB2ENR, RCC_APB2ENR_ADC2EN_Pos);
+        SET_BIT(RCC->APB2ENR, RCC_APB2ENR_ADC3EN_Pos);
+        HalAdc_StartDma((uint32_t)(uintptr_t)&ADC123_COMMON->CDR, pConfig->pBuffer, NULL,
+                        pConfig->bufferLength / SAMPLES_PER_CAPTURE_TRANSFER, DMA_CAPTURE_CONFIGURATION);
+        for (uint32_t i = 0UL; i < CAPTURE_ADC_COUNT; ++i)
+        {
+            ADC_TypeDef* pAdc = apCaptureAdcs[i];
+            CLEAR_BIT(pAdc->CR1, ADC_CR1_EOCIE_Pos);
+            CLEAR_BIT(pAdc->CR1, ADC_CR1_SCAN_Pos);
+            SET_BITFIELD(pAdc->CR1, ADC_CR1_RES_Pos, RESOLUTION_MASK, (uint32_t)pConfig->resolution);
+            SET_BITFIELD(pAdc->SQR1, ADC_SQR1_L_Pos, SEQUENCE_LENGTH_MASK, 0UL);
+            HalAdc_SetSequenceChannel(pAdc, 0UL, pConfig->channel);
+            // Together with a 12-bit conversion 15 cycles, i.e. three interleaving delays.
+            HalAdc_SetSampleTime(pAdc, pConfig->channel, ADC_SAMPLE_TIME_3_CYCLES);
+            HalAdc_SetWatchdogWindow(pAdc, pConfig->channel, pConfig->lowThreshold, pConfig->highThreshold);
+            SET_BIT(pAdc->CR1, ADC_CR1_AWDIE_Pos);
+            SET_BIT(pAdc->CR1, ADC_CR1_AWDEN_Pos);
+            SET_BIT(pAdc->CR2, ADC_CR2_CONT_Pos);
+            SET_BIT(pAdc->CR2, ADC_CR2_ADON_Pos);
+        }
+        SET_BITFIELD(ADC123_COMMON->CCR, ADC_CCR_DELAY_Pos, INTERLEAVE_DELAY_MASK, INTERLEAVE_DELAY_5_CYCLES);
+        SET_BITFIELD(ADC123_COMMON->CCR, ADC_CCR_DMA_Pos, MULTI_DMA_MODE_MASK, MULTI_DMA_MODE_2);
+        SET_BIT(ADC123_COMMON->CCR, ADC_CCR_DDS_Pos);
+        SET_BITFIELD(ADC123_COMMON->CCR, ADC_CCR_MULTI_Pos, MULTI_MODE_MASK, MULTI_MODE_TRIPLE_INTERLEAVED);
+
+        // The software start of the master starts all three ADCs.
+        SET_BIT(HAL_ADC->CR2, ADC_CR2_SWSTART_Pos);
+        error = ERROR_OK;
+    }
+    return error;
+}
+
+Error_t HalAdc_TriggerCapture(void)
+{
+    Error_t error;
+    if ((isCapturing == false) || isCaptureTriggered)
+    {
+        error = ERROR_INVALID_ACTION;
+    }
+    else
+    {
+        HalAdc_SetCaptureTrigger();
+        error = ERROR_OK;
+    }
+    return error;
+}
+
+Error_t HalAdc_StopCapture(void)
+{
+    Error_t error;
+    if (isCapturing == false)
+    {
+        error = ERROR_INVALID_ACTION;
+    }
+    else
+    {
+        HalAdc_StopCaptureAdcs();
+        error = ERROR_OK;
+    }
+    return error;
+}
+
+uint32_t HalAdc_GetConversionCycles(AdcResolution_t resolution, AdcSampleTime_t sampleTime)
+{
+    UTILS_ASSERT((resolution <= ADC_RES_8_BIT), HAL_ADC_FAILURE, 0UL);
+    UTILS_ASSERT((sampleTime < ADC_SAMPLE_TIME_COUNT), HAL_ADC_FAILURE, 0UL);
+
+    // See STM32F429ZI reference manual chapter 13.5.
+    return (uint32_t)aSampleCycles[sampleTime] + ADC_RESOLUTION_BITS(resolution);
+}
+
+uint32_t HalAdc_GetMaxLatencyCycles(void)
+{
+    return maxLatencyCycles;
+}
+
+void ADC_IRQHandler(void)
+{
+    // During a scan the end of conversion flag is set too, but the DMA takes the results.
+    if (isConverting && GET_BIT(HAL_ADC->SR, ADC_SR_EOC_Pos))
+    {
+        // Reading the data register clears the end of conversion flag.
+        uint16_t result = (uint16_t)REG_READ(HAL_ADC->DR);
+        uint32_t latency = REG_READ(DWT->CYCCNT) - startCycles;
+        if (latency > maxLatencyCycles)
+        {
+            maxLatencyCycles = latency;
+        }
+
+        // The conversion is completed before the callback, so that the callback may start the next one.
+        AdcChannel_t channel = activeChannel;
+        isConverting = false;
+        aCallbacks[channel](result);
+    }
+
+    if (isInjectedConverting && GET_BIT(HAL_ADC->SR, ADC_SR_JEOC_Pos))
+    {
+        // The sequence is completed before the callbacks, so that a callback may start the next one.
+        REG_WRITE(HAL_ADC->SR, ~(uint32_t)ADC_SR_JEOC);
+        uint16_t aResults[ADC_INJECTED_MAX_CHANNELS];
+        uint32_t channelCount = injectedChannelCount;
+        for (uint32_t rank = 0UL; rank < channelCount; ++rank)
+        {
+            aResults[rank] = HalAdc_ReadInjectedResult(rank);
+        }
+        isInjectedConverting = false;
+        for (uint32_t rank = 0UL; rank < channelCount; ++rank)
+        {
+            aInjectedCallbacks[rank](aResults[rank]);
+        }
+    }
+
+    // The data register keeps the result after the end of conversion handling above has read it.
+    if (isWatchdogArmed && GET_BIT(HAL_ADC->SR, ADC_SR_AWD_Pos))
+    {
+        // The status flags are cleared by writing zero, so the other flags are written as ones.
+        CLEAR_BIT(HAL_ADC->CR1, ADC_CR1_AWDIE_Pos);
+        REG_WRITE(HAL_ADC->SR, ~(uint32_t)ADC_SR_AWD);
+        isWatchdogArmed = false;
+        WatchdogCallback((uint16_t)REG_READ(HAL_ADC->DR));
+    }
+
+    if (isCapturing)
+    {
+        // Any of the interleaved ADCs may see the first sample outside the window.
+        bool isOutsideWindow = false;
+        for (uint32_t i = 0UL; i < CAPTURE_ADC_COUNT; ++i)
+        {
+            if (GET_BIT(apCaptureAdcs[i]->SR, ADC_SR_AWD_Pos))
+            {
+                REG_WRITE(apCaptureAdcs[i]->SR, ~(uint32_t)ADC_SR_AWD);
+                isOutsideWindow = true;
+            }
+        }
+
+        if (isOutsideWindow && (isCaptureTriggered == false))
+        {
+            HalAdc_SetCaptureTrigger();
+        }
+    }
+    return;
+}
+
+void DMA2_Stream0_IRQHandler(void)
+{
+    // See STM32F429ZI reference manual chapters 10.5.1 and 10.5.3. A late interrupt may have both halves ready, and the
+    // first half is older.
+    if (GET_BIT(HAL_DMA->LISR, DMA_LISR_HTIF0_Pos))
+    {
+        REG_WRITE(HAL_DMA->LIFCR, DMA_LIFCR_CHTIF0);
+        if (isCapturing)
+        {
+            HalAdc_HandleCaptureBoundary(captureLength / 2UL);
+        }
+        else if (isScanning && (isLending == false))
+        {
+            ScanCallback(pScanBuffer, scanBlockLength);
+        }
+    }
+
+    if (GET_BIT(HAL_DMA->LISR, DMA_LISR_TCIF0_Pos))
+    {
+        REG_WRITE(HAL_DMA->LIFCR, DMA_LIFCR_CTCIF0);
+        if (isCapturing)
+        {
+            HalAdc_HandleCaptureBoundary(0UL);
+        }
+        else if (isLending)
+        {
+            HalAdc_LendBlock();
+        }
+        else if (isScanning)
+        {
+            ScanCallback(&pScanBuffer[scanBlockLength], scanBlockLength);
+        }
+    }
+
+    if (GET_BIT(HAL_DMA->LISR, DMA_LISR_TEIF0_Pos))
+    {
+        REG_WRITE(HAL_DMA->LIFCR, DMA_LIFCR_CTEIF0);
+        System_RaiseError(HAL_ADC_FAILURE);
+    }
+    return;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Static Function Definitions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+staticf void HalAdc_Enable(void)
+{
+    // See STM32F429ZI reference manual chapters 6.3.14, 13.13.2, 13.13.3 and 13.13.16.
+    SET_BIT(RCC->APB2ENR, RCC_APB2ENR_ADC1EN_Pos);
+    SET_BITFIELD(ADC123_COMMON->CCR, ADC_CCR_ADCPRE_Pos, PRESCALER_MASK, PRESCALER_DIV_4);
+    SET_BIT(HAL_ADC->CR2, ADC_CR2_ADON_Pos);
+    NVIC_EnableIRQ(ADC_IRQn);
+    return;
+}
+
+staticf void HalAdc_SetSampleTime(ADC_TypeDef* pAdc, AdcChannel_t channel, AdcSampleTime_t sampleTime)
+{
+    // See STM32F429ZI reference manual chapters 13.13.4 and 13.13.5.
+    if (channel < SMPR1_FIRST_CHANNEL)
+    {
+        SET_BITFIELD(pAdc->SMPR2, (uint32_t)channel * BITS_IN_SAMPLE_TIME, SAMPLE_TIME_MASK, (uint32_t)sampleTime);
+    }
+    else
+    {
+        SET_BITFIELD(pAdc->SMPR1, ((uint32_t)channel - SMPR1_FIRST_CHANNEL) * BITS_IN_SAMPLE_TIME, SAMPLE_TIME_MASK,
+                     (uint32_t)sampleTime);
+    }
+    return;
+}
+
+staticf void HalAdc_SetSequenceChannel(ADC_TypeDef* pAdc, uint32_t rank, AdcChannel_t channel)
+{
+    // See STM32F429ZI reference manual chapters 13.13.9 to 13.13.11.
+    if (rank < SQR3_CHANNELS)
+    {
+        SET_BITFIELD(pAdc->SQR3, rank * BITS_IN_SEQUENCE_CHANNEL, SEQUENCE_CHANNEL_MASK, (uint32_t)channel);
+    }
+    else if (rank < (SQR3_CHANNELS + SQR2_CHANNELS))
+    {
+        SET_BITFIELD(pAdc->SQR2, (rank - SQR3_CHANNELS) * BITS_IN_SEQUENCE_CHANNEL, SEQUENCE_CHANNEL_MASK,
+                     (uint32_t)channel);
+    }
+    else
+    {
+        SET_BITFIELD(pAdc->SQR1, (rank - SQR3_CHANNELS - SQR2_CHANNELS) * BITS_IN_SEQUENCE_CHANNEL,
+                     SEQUENCE_CHANNEL_MASK, (uint32_t)channel);
+    }
+    return;
+}
+
+staticf bool HalAdc_IsInjectedConfigValid(const AdcInjectedConfig_t* pConfig)
+{
+    bool isValid = (pConfig != NULL) &&
+                   (pConfig->pChannels != NULL) &&
+                   (pConfig->channelCount > 0UL) &&
+                   (pConfig->channelCount <= ADC_INJECTED_MAX_CHANNELS);
+    for (uint32_t rank = 0UL; isValid && (rank < pConfig->channelCount); ++rank)
+    {
+        isValid = (pConfig->pChannels[rank].channel < ADC_CHANNEL_COUNT) &&
+                  (pConfig->pChannels[rank].sampleTime < ADC_SAMPLE_TIME_COUNT) &&
+                  (pConfig->pChannels[rank].Callback != NULL);
+    }
+    return isValid;
+}
+
+staticf uint16_t HalAdc_ReadInjectedResult(uint32_t rank)
+{
+    // See STM32F429ZI reference manual chapter 13.13.14.
+    uint32_t result;
+    switch (rank)
+    {
+        case 0UL:
+            result = REG_READ(HAL_ADC->JDR1);
+            break;
+        case 1UL:
+            result = REG_READ(HAL_ADC->JDR2);
+            break;
+        case 2UL:
+            result = REG_READ(HAL_ADC->JDR3);
+            break;
+        default:
+            result = REG_READ(HAL_ADC->JDR4);
+            break;
+    }
+    return (uint16_t)result;
+}
+
+staticf void HalAdc_SetWatchdogWindow(ADC_TypeDef* pAdc, AdcChannel_t channel, uint16_t lowThreshold,
+                                      uint16_t highThreshold)
+{
+    REG_WRITE(pAdc->LTR, (uint32_t)lowThreshold);
+    REG_WRITE(pAdc->HTR, (uint32_t)highThreshold);
+    SET_BITFIELD(pAdc->CR1, ADC_CR1_AWDCH_Pos, WATCHDOG_CHANNEL_MASK, (uint32_t)channel);
+    SET_BIT(pAdc->CR1, ADC_CR1_AWDSGL_Pos);
+    REG_WRITE(pAdc->SR, ~(uint32_t)ADC_SR_AWD);
+    return;
+}
+
+staticf bool HalAdc_IsScanConfigValid(const AdcScanConfig_t* pConfig)
+{
+    bool isValid = (pConfig != NULL) &&
+                   (pConfig->pChannels != NULL) &&
+                   (pConfig->channelCount > 0UL) &&
+                   (pConfig->channelCount <= ADC_SCAN_MAX_CHANNELS) &&
+                   (pConfig->resolution <= ADC_RES_8_BIT) &&
+                   (pConfig->sampleTime < ADC_SAMPLE_TIME_COUNT) &&
+                   ((pConfig->pBuffer != NULL) || ((pConfig->bufferLength / 2UL) <= ADC_POOL_BLOCK_LENGTH)) &&
+                   (pConfig->bufferLength > 0UL) &&
+                   (pConfig->bufferLength <= ADC_SCAN_MAX_BUFFER_LENGTH) &&
+                   ((pConfig->bufferLength % (2UL * pConfig->channelCount)) == 0UL) &&
+                   (pConfig->Callback != NULL) &&
+                   (pConfig->trigger < ADC_TRIGGER_COUNT) &&
+                   ((pConfig->trigger == ADC_TRIGGER_CONTINUOUS) ||
+                    ((pConfig->scanRate > 0UL) &&
+                     ((HalAdc_GetTimerClock(pConfig->trigger) / pConfig->scanRate) >= TIMER_MIN_PERIOD)));
+
+    // A triggered scan must end before the next trigger even at the slowest ADC clock.
+    if (isValid && (pConfig->trigger != ADC_TRIGGER_CONTINUOUS))
+    {
+        uint32_t scanCycles = pConfig->channelCount * CPU_CYCLES_PER_ADC_CYCLE *
+                              HalAdc_GetConversionCycles(pConfig->resolution, pConfig->sampleTime);
+        isValid = (scanCycles <= (SystemCoreClock / pConfig->scanRate));
+    }
+
+    for (uint32_t i = 0UL; isValid && (i < pConfig->channelCount); ++i)
+    {
+        isValid = (pConfig->pChannels[i] < ADC_CHANNEL_COUNT);
+    }
+    return isValid;
+}
+
+staticf bool HalAdc_IsCaptureConfigValid(const AdcCaptureConfig_t* pConfig)
+{
+    // Only the channels 0 to 3 and 10 to 13 are on the same pins on all three ADCs.
+    bool isValid = (pConfig != NULL) &&
+                   ((pConfig->channel <= ADC_CHANNEL_3) ||
+                    ((pConfig->channel >= ADC_CHANNEL_10) && (pConfig->channel <= ADC_CHANNEL_13))) &&
+                   (pConfig->resolution <= ADC_RES_8_BIT) &&
+                   (pConfig->pBuffer != NULL) &&
+                   (((uintptr_t)pConfig->pBuffer % sizeof(uint32_t)) == 0UL) &&
+                   (pConfig->bufferLength > 0UL) &&
+                   (pConfig->bufferLength <= ADC_CAPTURE_MAX_BUFFER_LENGTH) &&
+                   ((pConfig->bufferLength % (2UL * SAMPLES_PER_CAPTURE_TRANSFER)) == 0UL) &&
+                   (pConfig->postTriggerLength > 0UL) &&
+                   (pConfig->postTriggerLength <= (pConfig->bufferLength / 2UL)) &&
+                   (pConfig->lowThreshold <= pConfig->highThreshold) &&
+                   (pConfig->highThreshold <= ADC_WATCHDOG_MAX_THRESHOLD) &&
+                   (pConfig->Callback != NULL);
+    return isValid;
+}
+
+staticf void HalAdc_StartDma(uint32_t peripheralAddress, uint16_t* pBuffer, uint16_t* pSecondBuffer, uint32_t transfers,
+                             uint32_t configuration)
+{
+    // See STM32F429ZI reference manual chapters 6.3.10, 10.3.17 and 10.5.5 to 10.5.9. The stream is configured only
+    // while it is disabled.
+    SET_BIT(RCC->AHB1ENR, RCC_AHB1ENR_DMA2EN_Pos);
+    CLEAR_BIT(HAL_DMA_STREAM->CR, DMA_SxCR_EN_Pos);
+    while (GET_BIT(HAL_DMA_STREAM->CR, DMA_SxCR_EN_Pos))
+    {
+        // Wait for the running transfer to end.
+    }
+    REG_WRITE(HAL_DMA->LIFCR, DMA_LIFCR_CHTIF0 | DMA_LIFCR_CTCIF0 | DMA_LIFCR_CTEIF0);
+    REG_WRITE(HAL_DMA_STREAM->PAR, peripheralAddress);
+    REG_WRITE(HAL_DMA_STREAM->M0AR, (uint32_t)(uintptr_t)pBuffer);
+    REG_WRITE(HAL_DMA_STREAM->M1AR, (uint32_t)(uintptr_t)pSecondBuffer);
+    REG_WRITE(HAL_DMA_STREAM->NDTR, transfers);
+    REG_WRITE(HAL_DMA_STREAM->CR, configuration);
+    SET_BIT(HAL_DMA_STREAM->CR, DMA_SxCR_EN_Pos);
+    NVIC_EnableIRQ(DMA2_Stream0_IRQn);
+    return;
+}
+
+staticf uint32_t HalAdc_AcquireBlock(void)
+{
+    uint32_t block = ADC_POOL_BLOCK_COUNT;
+    for (uint32_t i = 0UL; (i < ADC_POOL_BLOCK_COUNT) && (block == ADC_POOL_BLOCK_COUNT); ++i)
+    {
+        if (aBlockStates[i] == BLOCK_FREE)
+        {
+            aBlockStates[i] = BLOCK_DMA;
+            block = i;
+        }
+    }
+    return block;
+}
+
+staticf uint32_t HalAdc_CountFreeBlocks(void)
+{
+    uint32_t count = 0UL;
+    for (uint32_t i = 0UL; i < ADC_POOL_BLOCK_COUNT; ++i)
+    {
+        if (aBlockStates[i] == BLOCK_FREE)
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+
+staticf uint32_t HalAdc_FindBlock(const uint16_t* pBlock)
+{
+    uint32_t block = ADC_POOL_BLOCK_COUNT;
+    for (uint32_t i = 0UL; i < ADC_POOL_BLOCK_COUNT; ++i)
+    {
+        if (pBlock == aBlockPool[i])
+        {
+            block = i;
+        }
+    }
+    return block;
+}
+
+staticf void HalAdc_LendBlock(void)
+{
+    // See STM32F429ZI reference manual chapters 10.3.9 and 10.5.5. The stream has switched to the other memory, and
+    // the address of the completed one may be changed until the stream switches back.
+    uint32_t memory = GET_BIT(HAL_DMA_STREAM->CR, DMA_SxCR_CT_Pos) ? 0UL : 1UL;
+    uint32_t freeBlock = HalAdc_AcquireBlock();
+    if (freeBlock < ADC_POOL_BLOCK_COUNT)
+    {
+        uint32_t completedBlock = aDmaBlocks[memory];
+        if (memory == 0UL)
+        {
+            REG_WRITE(HAL_DMA_STREAM->M0AR, (uint32_t)(uintptr_t)aBlockPool[freeBlock]);
+        }
+        else
+        {
+            REG_WRITE(HAL_DMA_STREAM->M1AR, (uint32_t)(uintptr_t)aBlockPool[freeBlock]);
+        }
+        aDmaBlocks[memory] = freeBlock;
+        aBlockStates[completedBlock] = BLOCK_LENT;
+        ScanCallback(aBlockPool[completedBlock], scanBlockLength);
+    }
+    else
+    {
+        // The stream fills the completed block again.
+        ++droppedBlocks;
+    }
+    return;
+}
+
+staticf TIM_TypeDef* HalAdc_SetTriggerTimer(AdcTrigger_t trigger)
+{
+    // See STM32F429ZI reference manual chapters 6.3.13, 6.3.14 and 13.13.3.
+    TIM_TypeDef* pTimer;
+    uint32_t extsel;
+    switch (trigger)
+    {
+        case ADC_TRIGGER_TIM2_TRGO:
+            SET_BIT(RCC->APB1ENR, RCC_APB1ENR_TIM2EN_Pos);
+            pTimer = TIM2;
+            extsel = EXTSEL_TIM2_TRGO;
+            break;
+        case ADC_TRIGGER_TIM3_TRGO:
+            SET_BIT(RCC->APB1ENR, RCC_APB1ENR_TIM3EN_Pos);
+            pTimer = TIM3;
+            extsel = EXTSEL_TIM3_TRGO;
+            break;
+        default:
+            SET_BIT(RCC->APB2ENR, RCC_APB2ENR_TIM8EN_Pos);
+            pTimer = TIM8;
+            extsel = EXTSEL_TIM8_TRGO;
+            break;
+    }
+    SET_BITFIELD(HAL_ADC->CR2, ADC_CR2_EXTSEL_Pos, EXTSEL_MASK, extsel);
+    SET_BITFIELD(HAL_ADC->CR2, ADC_CR2_EXTEN_Pos, EXTEN_MASK, EXTEN_RISING_EDGE);
+    return pTimer;
+}
+
+staticf void HalAdc_StartTriggerTimer(TIM_TypeDef* pTimer, uint32_t period)
+{
+    // See STM32F429ZI reference manual chapters 17.4 and 18.4. The period is split into a prescaler and an auto-reload
+    // value that both fit in 16 bits.
+    uint32_t prescaler = (period - 1UL) / TIMER_PRESCALER_RANGE;
+    CLEAR_BIT(pTimer->CR1, TIM_CR1_CEN_Pos);
+    REG_WRITE(pTimer->PSC, prescaler);
+    REG_WRITE(pTimer->ARR, (period / (prescaler + 1UL)) - 1UL);
+
+    // The update generation loads the prescaler before TRGO is connected to the update event, so it does not trigger
+    // a scan.
+    REG_WRITE(pTimer->EGR, TIM_EGR_UG);
+    SET_BITFIELD(pTimer->CR2, TIM_CR2_MMS_Pos, TIMER_MMS_MASK, TIMER_MMS_UPDATE);
+    SET_BIT(pTimer->CR1, TIM_CR1_CEN_Pos);
+    return;
+}
+
+staticf uint32_t HalAdc_GetTimerClock(AdcTrigger_t trigger)
+{
+    // See STM32F429ZI reference manual chapters 6.2 and 6.3.3. TIM2 and TIM3 are on APB1 and TIM8 on APB2. A timer
+    // runs at twice its APB clock when the APB prescaler divides HCLK. TIMPRE is expected to be at its reset value.
+    uint32_t position = (trigger == ADC_TRIGGER_TIM8_TRGO) ? RCC_CFGR_PPRE2_Pos : RCC_CFGR_PPRE1_Pos;
+    uint32_t apbPrescaler = GET_BITFIELD(RCC->CFGR, position, APB_PRESCALER_MASK);
+    uint32_t clock = SystemCoreClock;
+    if (apbPrescaler >= APB_PRESCALER_DIV_2)
+    {
+        clock = SystemCoreClock >> (apbPrescaler - APB_PRESCALER_DIV_2);
+    }
+    return clock;
+}
+
+staticf uint32_t HalAdc_GetDmaIndex(uint32_t bufferLength, uint32_t samplesPerTransfer)
+{
+    // See STM32F429ZI reference manual chapter 10.5.7. The counter holds the transfers left before the wrap-around.
+    return (bufferLength - (REG_READ(HAL_DMA_STREAM->NDTR) * samplesPerTransfer)) % bufferLength;
+}
+
+staticf void HalAdc_SetCaptureTrigger(void)
+{
+    uint32_t halfLength = captureLength / 2UL;
+    uint32_t triggerIndex = HalAdc_GetDmaIndex(captureLength, SAMPLES_PER_CAPTURE_TRANSFER);
+    uint32_t nextBoundary = (triggerIndex < halfLength) ? halfLength : captureLength;
+
+    // The flag of the boundary before the trigger may still be pending, and it shall not end the capture.
+    REG_WRITE(HAL_DMA->LIFCR, (nextBoundary == halfLength) ? DMA_LIFCR_CTCIF0 : DMA_LIFCR_CHTIF0);
+    if ((nextBoundary - triggerIndex) < capturePostLength)
+    {
+        nextBoundary += halfLength;
+    }
+    captureStopIndex = nextBoundary % captureLength;
+    captureTriggerIndex = triggerIndex;
+    isCaptureTriggered = true;
+    for (uint32_t i = 0UL; i < CAPTURE_ADC_COUNT; ++i)
+    {
+        CLEAR_BIT(apCaptureAdcs[i]->CR1, ADC_CR1_AWDIE_Pos);
+    }
+    return;
+}
+
+staticf void HalAdc_StopCaptureAdcs(void)
+{
+    // The conversions are stopped before the DMA, so that the ADCs do not overrun.
+    for (uint32_t i = 0UL; i < CAPTURE_ADC_COUNT; ++i)
+    {
+        ADC_TypeDef* pAdc = apCaptureAdcs[i];
+        CLEAR_BIT(pAdc->CR2, ADC_CR2_CONT_Pos);
+        CLEAR_BIT(pAdc->CR1, ADC_CR1_AWDEN_Pos);
+        CLEAR_BIT(pAdc->CR1, ADC_CR1_AWDIE_Pos);
+    }
+    CLEAR_BIT(HAL_DMA_STREAM->CR, DMA_SxCR_EN_Pos);
+    while (GET_BIT(HAL_DMA_STREAM->CR, DMA_SxCR_EN_Pos))
+    {
+        // Wait for the running transfer to end.
+    }
+    NVIC_DisableIRQ(DMA2_Stream0_IRQn);
+    SET_BITFIELD(ADC123_COMMON->CCR, ADC_CCR_MULTI_Pos, MULTI_MODE_MASK, MULTI_MODE_INDEPENDENT);
+    SET_BITFIELD(ADC123_COMMON->CCR, ADC_CCR_DMA_Pos, MULTI_DMA_MODE_MASK, 0UL);
+    CLEAR_BIT(ADC123_COMMON->CCR, ADC_CCR_DDS_Pos);
+    isCapturing = false;
+    return;
+}
+
+staticf void HalAdc_HandleCaptureBoundary(uint32_t boundaryIndex)
+{
+    if (isCaptureTriggered && (boundaryIndex == captureStopIndex))
+    {
+        // The DMA runs on until it is stopped, so the oldest sample is where it stopped.
+        HalAdc_StopCaptureAdcs();
+        const AdcCapture_t capture =
+        {
+            .pBuffer = pCaptureBuffer,
+            .length = captureLength,
+            .firstIndex = HalAdc_GetDmaIndex(captureLength, SAMPLES_PER_CAPTURE_TRANSFER),
+            .triggerIndex = captureTriggerIndex
+        };
+        CaptureCallback(&capture);
+    }
+    return;
+}
@@ -53,6 +53,11 @@
 #define PULL_POSITION(pin_)             ((pin_)->number * BITS_IN_PULL)
 #define AFRL_POSITION(pin_)             ((pin_)->number * BITS_IN_AF)
 #define AFRH_POSITION(pin_)             (((pin_)->number - AF_LOW_REGISTER_LIMIT) * BITS_IN_AF)
+#define AF_REGISTER(pin_)               ((pin_)->number / AF_LOW_REGISTER_LIMIT)
+#define AF_POSITION(pin_)               (((pin_)->number % AF_LOW_REGISTER_LIMIT) * BITS_IN_AF)
+
+//! Replaces the masked bits of a register with a value in one read and one write.
+#define MODIFY_REGISTER(register_, mask_, value_)   REG_WRITE((register_), (REG_READ(register_) & ~(mask_)) | (value_))
 
 //-----------------------------------------------------------------------------------------------------------------------------
 // Static Variables
@@ -144,6 +149,16 @@ staticf GpioAf_t HalGpio_GetAlternateFunction(const GpioPin_t* pPin);
 /// @param alternateFunction - New GPIO alternate function configuration.
 staticf void HalGpio_SetAlternateFunction(const GpioPin_t* pPin, GpioAf_t alternateFunction);
 
+/// @brief This function adds the register fields of a pin into the configuration of its port. A later pin replaces the
+/// fields of an earlier configuration of the same pin.
+/// @param pGpio - A pointer to the pin configuration.
+/// @param pPortConfig - A pointer to the port configuration.
+staticf void HalGpio_AddToPortConfig(const GpioConfig_t* pGpio, GpioPortConfig_t* pPortConfig);
+
+/// @brief This function writes the configuration of a port with one read-modify-write per register.
+/// @param pPortConfig - A pointer to the port configuration.
+staticf void HalGpio_WritePortConfig(const GpioPortConfig_t* pPortConfig);
+
 /// @brief This function enables the clock for given port.
 /// @param port - The port which clock will be enabled.
 staticf void HalGpio_EnablePortClock(GpioPort_t port);
@@ -179,6 +194,55 @@ void HalGpio_SetConfiguration(const GpioConfig_t* pGpio)
     return;
 }
 
+void HalGpio_SetConfigurationArray(const GpioConfig_t* pGpios, uint32_t pinCount)
+{
+    UTILS_ASSERT_VOID((pGpios != NULL), HAL_GPIO_FAILURE);
+
+    uint32_t usedPorts = 0UL;
+    bool isValid = true;
+    for (uint32_t i = 0UL; i < pinCount; ++i)
+    {
+        isValid = isValid && (pGpios[i].pin.port <= portK) && (pGpios[i].pin.number < MAX_PINS);
+        usedPorts |= BIT((uint32_t)pGpios[i].pin.port);
+    }
+    UTILS_ASSERT_VOID(isValid, HAL_GPIO_FAILURE);
+
+    for (uint32_t port = (uint32_t)portA; port <= (uint32_t)portK; ++port)
+    {
+        if ((usedPorts & BIT(port)) != 0UL)
+        {
+            GpioPortConfig_t portConfig = {.port = (GpioPort_t)port};
+            for (uint32_t i = 0UL; i < pinCount; ++i)
+            {
+                if (pGpios[i].pin.port == (GpioPort_t)port)
+                {
+                    HalGpio_AddToPortConfig(&pGpios[i], &portConfig);
+                }
+            }
+            HalGpio_WritePortConfig(&portConfig);
+        }
+    }
+    return;
+}
+
+void HalGpio_SetPortConfigurations(const GpioPortConfig_t* pConfigs, uint32_t portCount)
+{
+    UTILS_ASSERT_VOID((pConfigs != NULL), HAL_GPIO_FAILURE);
+
+    bool isValid = true;
+    for (uint32_t i = 0UL; i < portCount; ++i)
+    {
+        isValid = isValid && (pConfigs[i].port <= portK);
+    }
+    UTILS_ASSERT_VOID(isValid, HAL_GPIO_FAILURE);
+
+    for (uint32_t i = 0UL; i < portCount; ++i)
+    {
+        HalGpio_WritePortConfig(&pConfigs[i]);
+    }
+    return;
+}
+
 void HalGpio_SetOutputState(const GpioPin_t* pPin, bool state)
 {
     UTILS_ASSERT_VOID((pPin != NULL), HAL_GPIO_FAILURE);
@@ -196,6 +260,18 @@ void HalGpio_SetOutputState(const GpioPin_t* pPin, bool state)
     return;
 }
 
+void HalGpio_WritePortMasked(GpioPort_t port, uint16_t mask, uint16_t value)
+{
+    UTILS_ASSERT_VOID((port <= portK), HAL_GPIO_FAILURE);
+
+    // See STM32F429ZI datasheet chapter 8.4.7. The set bits set and the reset bits clear the outputs in one write, and
+    // the zero bits leave the other pins untouched.
+    uint32_t setBits = (uint32_t)mask & (uint32_t)value;
+    uint32_t resetBits = (uint32_t)mask & ~(uint32_t)value;
+    REG_WRITE(apGpios[port]->BSRR, setBits | (resetBits << BIT_CLEAR_OFFSET));
+    return;
+}
+
 bool HalGpio_GetInputState(const GpioPin_t* pPin)
 {
     UTILS_ASSERT((pPin != NULL), HAL_GPIO_FAILURE, false);
@@ -298,6 +374,51 @@ staticf void HalGpio_SetAlternateFunction(const GpioPin_t* pPin, GpioAf_t altern
     return;
 }
 
+staticf void HalGpio_AddToPortConfig(const GpioConfig_t* pGpio, GpioPortConfig_t* pPortConfig)
+{
+    const GpioPin_t* pPin = &pGpio->pin;
+    uint32_t modeMask = MODE_MASK << MODE_POSITION(pPin);
+    pPortConfig->modeMask |= modeMask;
+    pPortConfig->mode = (pPortConfig->mode & ~modeMask) | ((uint32_t)pGpio->mode << MODE_POSITION(pPin));
+
+    uint32_t openDrainMask = BIT(pPin->number);
+    pPortConfig->openDrainMask |= openDrainMask;
+    pPortConfig->openDrain = (pPortConfig->openDrain & ~openDrainMask) | (pGpio->isOpenDrain ? openDrainMask : 0UL);
+
+    uint32_t speedMask = SPEED_MASK << SPEED_POSITION(pPin);
+    pPortConfig->speedMask |= speedMask;
+    pPortConfig->speed = (pPortConfig->speed & ~speedMask) | ((uint32_t)pGpio->speed << SPEED_POSITION(pPin));
+
+    uint32_t pullMask = PULL_MASK << PULL_POSITION(pPin);
+    pPortConfig->pullMask |= pullMask;
+    pPortConfig->pull = (pPortConfig->pull & ~pullMask) | ((uint32_t)pGpio->pull << PULL_POSITION(pPin));
+
+    uint32_t afMask = AF_MASK << AF_POSITION(pPin);
+    pPortConfig->aAfMasks[AF_REGISTER(pPin)] |= afMask;
+    pPortConfig->aAfs[AF_REGISTER(pPin)] = (pPortConfig->aAfs[AF_REGISTER(pPin)] & ~afMask) |
+                                           ((uint32_t)pGpio->alternateFunction << AF_POSITION(pPin));
+    return;
+}
+
+staticf void HalGpio_WritePortConfig(const GpioPortConfig_t* pPortConfig)
+{
+    // See STM32F429ZI datasheet chapters 8.4.1 to 8.4.4, 8.4.9 and 8.4.10.
+    GPIO_TypeDef* pGpio = apGpios[pPortConfig->port];
+    HalGpio_EnablePortClock(pPortConfig->port);
+    MODIFY_REGISTER(pGpio->MODER, pPortConfig->modeMask, pPortConfig->mode);
+    MODIFY_REGISTER(pGpio->OTYPER, pPortConfig->openDrainMask, pPortConfig->openDrain);
+    MODIFY_REGISTER(pGpio->OSPEEDR, pPortConfig->speedMask, pPortConfig->speed);
+    MODIFY_REGISTER(pGpio->PUPDR, pPortConfig->pullMask, pPortConfig->pull);
+    for (uint32_t i = 0UL; i < GPIO_AF_REGISTER_COUNT; ++i)
+    {
+        if (pPortConfig->aAfMasks[i] != 0UL)
+        {
+            MODIFY_REGISTER(pGpio->AFR[i], pPortConfig->aAfMasks[i], pPortConfig->aAfs[i]);
+        }
+    }
+    return;
+}
+
 staticf void HalGpio_EnablePortClock(GpioPort_t port)
 {
     SET_BIT(RCC->AHB1ENR, clockEnableBits[port]);
@@ -0,0 +1,16 @@
+add_executable(run_bench_gpio
+               ${CMAKE_CURRENT_LIST_DIR}/bench_gpio.cpp
+               ${CMAKE_CURRENT_LIST_DIR}/../../CMSIS/mocks/stm32f429xx_mock.c
+               ${CMAKE_CURRENT_LIST_DIR}/../sources/gpio.c)
+
+target_include_directories(run_bench_gpio PUBLIC
+                           "${CMAKE_CURRENT_LIST_DIR}/../../../TestingUtils/FFF"
+                           "${CMAKE_CURRENT_LIST_DIR}/../../CMSIS/include"
+                           "${CMAKE_CURRENT_LIST_DIR}/../../CMSIS/mocks"
+                           "${CMAKE_CURRENT_LIST_DIR}/../../System/include"
+                           "${CMAKE_CURRENT_LIST_DIR}/../../System/mocks"
+                           "${CMAKE_CURRENT_LIST_DIR}/../../Utils/include"
+                           "${CMAKE_CURRENT_LIST_DIR}/../mocks"
+                           "${CMAKE_CURRENT_LIST_DIR}/../include")
+
+add_test(NAME bench_gpio COMMAND run_bench_gpio)
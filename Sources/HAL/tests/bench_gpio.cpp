@@ -0,0 +1,159 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2020 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    bench_gpio.cpp
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    17 Oct 2026
+//! 
+//! @brief   This is a host benchmark for the GPIO configuration.
+//! 
+//! The benchmark configures all 16 pins of 7 ports, i.e. 112 pins, once pin by pin with HalGpio_SetConfiguration()
+//! and once with HalGpio_SetConfigurationArray(), and counts the register accesses of both through the register
+//! mocks. A read-modify-write counts as one read and one write. The array shall take fewer accesses, since it reads
+//! and writes each configuration register of a port once for all its pins.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <fff.h>
+DEFINE_FFF_GLOBALS;
+
+extern "C" {
+#include "gpio.h"
+}
+
+// Mocks
+#include "hal_mock.h"
+#include "system_mock.h"
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Benchmark Parameters
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#define BENCH_PORT_COUNT        7U      //!< Number of configured ports.
+#define BENCH_PINS_PER_PORT     16U     //!< Number of configured pins per port.
+#define BENCH_PIN_COUNT         (BENCH_PORT_COUNT * BENCH_PINS_PER_PORT)
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Typedefs
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief Register accesses of a configuration.
+typedef struct
+{
+    uint32_t reads;     //!< Register reads.
+    uint32_t writes;    //!< Register writes.
+} BenchAccesses_t;
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Benchmark Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+static GpioConfig_t aConfigs[BENCH_PIN_COUNT];
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Helper Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief This function fills aConfigs with a mix of the pin configurations of a board, ordered by pin and not by
+/// port, as a board configuration table usually is.
+static void Bench_CreateConfigs(void);
+
+/// @brief This function resets the register mocks.
+static void Bench_ResetMocks(void);
+
+/// @brief This function counts the register accesses since the mocks were reset.
+/// @return Returns the register accesses.
+static BenchAccesses_t Bench_CountAccesses(void);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------------------------------------------------------
+
+int main(void)
+{
+    int result = 0;
+    Bench_CreateConfigs();
+
+    Bench_ResetMocks();
+    for (const GpioConfig_t& config : aConfigs)
+    {
+        HalGpio_SetConfiguration(&config);
+    }
+    BenchAccesses_t perPin = Bench_CountAccesses();
+
+    Bench_ResetMocks();
+    HalGpio_SetConfigurationArray(aConfigs, BENCH_PIN_COUNT);
+    BenchAccesses_t array = Bench_CountAccesses();
+
+    printf("%-28s %8s %8s %8s\n", "configuration of 112 pins", "reads", "writes", "total");
+    printf("%-28s %8u %8u %8u\n", "HalGpio_SetConfiguration", perPin.reads, perPin.writes, perPin.reads + perPin.writes);
+    printf("%-28s %8u %8u %8u\n", "HalGpio_SetConfigurationArray", array.reads, array.writes, array.reads + array.writes);
+
+    if ((System_RaiseError_fake.call_count != 0U) ||
+        ((array.reads + array.writes) >= (perPin.reads + perPin.writes)))
+    {
+        result = 1;
+    }
+    return result;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Helper Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+static void Bench_CreateConfigs(void)
+{
+    for (uint32_t i = 0UL; i < BENCH_PIN_COUNT; ++i)
+    {
+        aConfigs[i] =
+        {
+            .pin = {.port = (GpioPort_t)(i % BENCH_PORT_COUNT), .number = (uint8_t)(i / BENCH_PORT_COUNT)},
+            .mode = (GpioMode_t)(i % 4U),
+            .isOpenDrain = ((i % 3U) == 0U),
+            .speed = (GpioSpeed_t)((i / 4U) % 4U),
+            .pull = (GpioPull_t)(i % 3U),
+            .alternateFunction = (GpioAf_t)(i % 16U)
+        };
+    }
+    return;
+}
+
+static void Bench_ResetMocks(void)
+{
+    FFF_RESET_HISTORY();
+    HAL_MOCK_RESET();
+    SYSTEM_MOCK_RESET();
+    return;
+}
+
+static BenchAccesses_t Bench_CountAccesses(void)
+{
+    uint32_t readModifyWrites = SET_BIT_MOCK_fake.call_count + CLEAR_BIT_MOCK_fake.call_count +
+                                SET_BITFIELD_MOCK_fake.call_count;
+    BenchAccesses_t accesses =
+    {
+        .reads = REG_READ_MOCK_fake.call_count + GET_BIT_MOCK_fake.call_count + GET_BITFIELD_MOCK_fake.call_count +
+                 readModifyWrites,
+        .writes = REG_WRITE_MOCK_fake.call_count + readModifyWrites
+    };
+    return accesses;
+}
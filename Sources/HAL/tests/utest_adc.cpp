@@ -0,0 +1,2497 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2020 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    utest_adc.cpp
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    17 Oct 2026
+//! 
+//! @brief   These are unit tests for adc.c
+//! 
+//! These are unit tests for adc.c utilizing Catch2 and FFF.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#define CATCH_CONFIG_RUNNER
+#include <catch_utils.hpp>
+#include <fff.h>
+DEFINE_FFF_GLOBALS;
+#include "utest_helpers.hpp"
+
+extern "C" {
+#include "adc.h"
+}
+
+// Mocks
+#include "cmsis_mock.h"
+#include "hal_mock.h"
+#include "system_mock.h"
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    UTestHelper::InitRandom();
+    int result = Catch::Session().run(argc, argv);
+    return result;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Statics of UUT
+//-----------------------------------------------------------------------------------------------------------------------------
+
+extern "C" {
+
+/// @brief The pool block owner type of the UUT.
+typedef enum
+{
+    BLOCK_FREE = 0,
+    BLOCK_DMA,
+    BLOCK_LENT
+} BlockState_t;
+
+extern AdcCallback_t aCallbacks[ADC_CHANNEL_COUNT];
+extern AdcResolution_t aResolutions[ADC_CHANNEL_COUNT];
+extern AdcSampleTime_t aSampleTimes[ADC_CHANNEL_COUNT];
+extern volatile bool isConverting;
+extern volatile uint32_t maxLatencyCycles;
+extern volatile bool isScanning;
+extern TIM_TypeDef* pTriggerTimer;
+extern volatile bool isLending;
+extern uint16_t aBlockPool[ADC_POOL_BLOCK_COUNT][ADC_POOL_BLOCK_LENGTH];
+extern volatile BlockState_t aBlockStates[ADC_POOL_BLOCK_COUNT];
+extern volatile uint32_t droppedBlocks;
+extern volatile bool isWatchdogArmed;
+extern volatile bool isCapturing;
+extern uint32_t injectedChannelCount;
+extern volatile bool isInjectedConverting;
+extern volatile bool isCaptureTriggered;
+
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Test Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+static uint32_t callbackCalls;
+static uint16_t callbackResult;
+static uint32_t dataRegister;
+static uint32_t cycleCounter;
+static uint32_t blockCalls;
+static uint32_t watchdogCalls;
+static uint32_t updateTriggers;
+static const uint16_t* apBlocks[4];
+static uint32_t aBlockLengths[4];
+static uint16_t aScanBuffer[32];
+static uint32_t injectedCalls;
+static uint16_t aInjectedResults[ADC_INJECTED_MAX_CHANNELS];
+static uint32_t captureCalls;
+static AdcCapture_t lastCapture;
+alignas(uint32_t) static uint16_t aCaptureBuffer[32];
+static AdcInjectedChannel_t aInjectedChannels[ADC_INJECTED_MAX_CHANNELS];
+static const AdcChannel_t aScanChannels[ADC_SCAN_MAX_CHANNELS] =
+{
+    ADC_CHANNEL_15, ADC_CHANNEL_14, ADC_CHANNEL_13, ADC_CHANNEL_12, ADC_CHANNEL_11, ADC_CHANNEL_10, ADC_CHANNEL_9,
+    ADC_CHANNEL_8, ADC_CHANNEL_7, ADC_CHANNEL_6, ADC_CHANNEL_5, ADC_CHANNEL_4, ADC_CHANNEL_3, ADC_CHANNEL_2,
+    ADC_CHANNEL_1, ADC_CHANNEL_0
+};
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Helper Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief This helper function resets the driver and the mocks. It sets aInjectedChannels to channels 12, 3, 17 and 18,
+/// where channel 12 has the recording callback and a sample time of 84 cycles, and the others the injected callback.
+static void Helper_InitAdc(void);
+
+/// @brief This helper function configures a channel with the recording callback.
+/// @param channel - A channel to configure.
+/// @param resolution - A channel resolution.
+static void Helper_ConfigureChannel(AdcChannel_t channel, AdcResolution_t resolution);
+
+/// @brief A test callback that records the result.
+/// @param result - ADC result.
+static void Helper_RecordingCallback(uint16_t result);
+
+/// @brief A test callback of the injected channels that records the results in order.
+/// @param result - ADC result.
+static void Helper_InjectedCallback(uint16_t result);
+
+/// @brief A test callback that starts the next conversion.
+/// @param result - ADC result.
+static void Helper_RestartingCallback(uint16_t result);
+
+/// @brief A test block callback that records the blocks.
+/// @param pSamples - A pointer to the block.
+/// @param sampleCount - Number of samples in the block.
+static void Helper_BlockCallback(const uint16_t* pSamples, uint32_t sampleCount);
+
+/// @brief This helper function makes the register operations act on the mocked peripherals, so that the scan
+/// configuration can be checked from the register values.
+static void Helper_UseRegisterModel(void);
+
+/// @brief This helper function reads a bit of a mocked register without the register mocks.
+/// @param value - Register value.
+/// @param bit - Bit position.
+/// @return Returns true if the bit is set.
+static bool Helper_IsBitSet(uint32_t value, uint32_t bit);
+
+/// @brief This helper function creates a scan configuration of all 16 channels into aScanBuffer.
+/// @return Returns the configuration.
+static AdcScanConfig_t Helper_ScanConfig(void);
+
+/// @brief This helper function creates a scan configuration of all 16 channels into the pool with blocks of 16 samples.
+/// @return Returns the configuration.
+static AdcScanConfig_t Helper_PoolScanConfig(void);
+
+/// @brief This helper function creates a watchdog configuration of channel 12 with a window from 0x400 to 0xC00 and
+/// the recording callback.
+/// @return Returns the watchdog configuration.
+static AdcWatchdogConfig_t Helper_WatchdogConfig(void);
+
+/// @brief A watchdog callback that counts its calls.
+/// @param result - ADC result.
+static void Helper_WatchdogCallback(uint16_t result);
+
+/// @brief This helper function creates an 8-bit capture configuration of channel 3 into aCaptureBuffer with 8 samples
+/// after the trigger and a window from 0x10 to 0xE0.
+/// @return Returns the capture configuration.
+static AdcCaptureConfig_t Helper_CaptureConfig(void);
+
+/// @brief A capture callback that records the capture.
+/// @param pCapture - A pointer to the capture.
+static void Helper_CaptureCallback(const AdcCapture_t* pCapture);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Custom Fake Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief A custom fake of REG_READ() that reads the ADC data registers, the DWT cycle counter and the DMA counter.
+static uint32_t REG_READ_CustomFake(uint32_t* pRegister);
+
+/// @brief Custom fakes of the register operations that modify the mocked peripherals.
+static void REG_WRITE_RegisterModel(uint32_t* pRegister, uint32_t value);
+static void SET_BIT_RegisterModel(uint32_t* pRegister, uint32_t bit);
+static void CLEAR_BIT_RegisterModel(uint32_t* pRegister, uint32_t bit);
+static bool GET_BIT_RegisterModel(uint32_t* pRegister, uint32_t bit);
+static void SET_BITFIELD_RegisterModel(uint32_t* pRegister, uint32_t position, uint32_t mask, uint32_t pattern);
+static uint32_t GET_BITFIELD_RegisterModel(uint32_t* pRegister, uint32_t position, uint32_t mask);
+
+/// @brief A register model of REG_WRITE() that counts the TIM3 update generations that reach an armed ADC trigger.
+static void REG_WRITE_UpdateTrigger(uint32_t* pRegister, uint32_t value);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Test Cases
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//------------------------------------
+// HalAdc_SetConfiguration
+//------------------------------------
+
+SCENARIO ("ADC channel is configured", "[hal][adc]")
+{
+    GIVEN ("the ADC is not configured")
+    {
+        Helper_InitAdc();
+        AdcChannel_t channel = (AdcChannel_t)(rand() % ADC_CHANNEL_COUNT);
+
+        WHEN ("a random channel is configured")
+        {
+            INIT_MOCKS();
+            Helper_ConfigureChannel(channel, ADC_RES_10_BIT);
+
+            THEN ("no errors shall occur")
+            {
+                REQUIRE (NO_ASSERT_ERRORS);
+
+                AND_THEN ("the ADC clock shall be enabled")
+                {
+                    REQUIRE (MOCK_NEXT_CALLED_FUNCTION_IS(SET_BIT_MOCK));
+                    REQUIRE (MOCK_ARG_HISTORY(SET_BIT_MOCK, 0, 0) == &RCC->APB2ENR);
+                    REQUIRE (MOCK_ARG_HISTORY(SET_BIT_MOCK, 1, 0) == RCC_APB2ENR_ADC1EN_Pos);
+
+                    AND_THEN ("the ADC clock shall be PCLK2 divided by 4")
+                    {
+                        REQUIRE (MOCK_NEXT_CALLED_FUNCTION_IS(SET_BITFIELD_MOCK));
+                        REQUIRE (MOCK_ARG_HISTORY(SET_BITFIELD_MOCK, 0, 0) == &ADC123_COMMON->CCR);
+                        REQUIRE (MOCK_ARG_HISTORY(SET_BITFIELD_MOCK, 1, 0) == ADC_CCR_ADCPRE_Pos);
+                        REQUIRE (MOCK_ARG_HISTORY(SET_BITFIELD_MOCK, 2, 0) == (ADC_CCR_ADCPRE_Msk >> ADC_CCR_ADCPRE_Pos));
+                        REQUIRE (MOCK_ARG_HISTORY(SET_BITFIELD_MOCK, 3, 0) == 1UL);
+
+                        AND_THEN ("the ADC and its interrupt shall be enabled")
+                        {
+                            REQUIRE (MOCK_NEXT_CALLED_FUNCTION_IS(SET_BIT_MOCK));
+                            REQUIRE (MOCK_ARG_HISTORY(SET_BIT_MOCK, 0, 1) == &ADC1->CR2);
+                            REQUIRE (MOCK_ARG_HISTORY(SET_BIT_MOCK, 1, 1) == ADC_CR2_ADON_Pos);
+                            REQUIRE (MOCK_NEXT_CALLED_FUNCTION_IS(NVIC_EnableIRQ));
+                            REQUIRE (MOCK_LAST_ARG(NVIC_EnableIRQ, 0) == ADC_IRQn);
+
+                            AND_THEN ("the resolution, the sample time and the callback shall be stored for the conversions")
+                            {
+                                REQUIRE (aResolutions[channel] == ADC_RES_10_BIT);
+                                REQUIRE (aSampleTimes[channel] == ADC_SAMPLE_TIME_84_CYCLES);
+                                REQUIRE (aCallbacks[channel] == Helper_RecordingCallback);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("ADC configuration fails", "[hal][adc][error_handling]")
+{
+    GIVEN ("the ADC is not configured")
+    {
+        Helper_InitAdc();
+        AdcConfig_t config =
+        {
+            .channel = ADC_CHANNEL_3,
+            .resolution = ADC_RES_12_BIT,
+            .sampleTime = ADC_SAMPLE_TIME_84_CYCLES,
+            .Callback = Helper_RecordingCallback
+        };
+
+        WHEN ("a null configuration is set")
+        {
+            HalAdc_SetConfiguration(NULL);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+
+        WHEN ("an invalid channel is configured")
+        {
+            config.channel = ADC_CHANNEL_COUNT;
+            HalAdc_SetConfiguration(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+
+        WHEN ("an invalid resolution is configured")
+        {
+            config.resolution = (AdcResolution_t)(ADC_RES_8_BIT + 1);
+            HalAdc_SetConfiguration(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+
+        WHEN ("an invalid sample time is configured")
+        {
+            config.sampleTime = ADC_SAMPLE_TIME_COUNT;
+            HalAdc_SetConfiguration(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+
+        WHEN ("a channel is configured without a callback")
+        {
+            config.Callback = NULL;
+            HalAdc_SetConfiguration(&config);
+
+            THEN ("assert error shall occur and the channel shall stay unconfigured")
+            {
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+                REQUIRE (aCallbacks[ADC_CHANNEL_3] == NULL);
+            }
+        }
+    }
+}
+
+//------------------------------------
+// HalAdc_StartConversion
+//------------------------------------
+
+SCENARIO ("ADC conversion is started", "[hal][adc]")
+{
+    GIVEN ("a random channel is configured to 8-bit resolution")
+    {
+        Helper_InitAdc();
+        AdcChannel_t channel = (AdcChannel_t)(rand() % ADC_CHANNEL_COUNT);
+        Helper_ConfigureChannel(channel, ADC_RES_8_BIT);
+        HAL_MOCK_RESET();
+        MOCK_SET_CUSTOM_FAKE(REG_READ_MOCK, REG_READ_CustomFake);
+
+        WHEN ("a conversion is started")
+        {
+            INIT_MOCKS();
+            Error_t error = HalAdc_StartConversion(channel);
+
+            THEN ("no errors shall occur")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (NO_ASSERT_ERRORS);
+
+                AND_THEN ("the resolution shall be set")
+                {
+                    REQUIRE (MOCK_NEXT_CALLED_FUNCTION_IS(SET_BITFIELD_MOCK));
+                    REQUIRE (MOCK_ARG_HISTORY(SET_BITFIELD_MOCK, 0, 0) == &ADC1->CR1);
+                    REQUIRE (MOCK_ARG_HISTORY(SET_BITFIELD_MOCK, 1, 0) == ADC_CR1_RES_Pos);
+                    REQUIRE (MOCK_ARG_HISTORY(SET_BITFIELD_MOCK, 2, 0) == 0x3UL);
+                    REQUIRE (MOCK_ARG_HISTORY(SET_BITFIELD_MOCK, 3, 0) == ADC_RES_8_BIT);
+
+                    AND_THEN ("the sample time of the channel shall be 84 cycles")
+                    {
+                        REQUIRE (MOCK_NEXT_CALLED_FUNCTION_IS(SET_BITFIELD_MOCK));
+                        if (channel < ADC_CHANNEL_10)
+                        {
+                            REQUIRE (MOCK_ARG_HISTORY(SET_BITFIELD_MOCK, 0, 1) == &ADC1->SMPR2);
+                            REQUIRE (MOCK_ARG_HISTORY(SET_BITFIELD_MOCK, 1, 1) == (channel * 3UL));
+                        }
+                        else
+                        {
+                            REQUIRE (MOCK_ARG_HISTORY(SET_BITFIELD_MOCK, 0, 1) == &ADC1->SMPR1);
+                            REQUIRE (MOCK_ARG_HISTORY(SET_BITFIELD_MOCK, 1, 1) == ((channel - 10UL) * 3UL));
+                        }
+                        REQUIRE (MOCK_ARG_HISTORY(SET_BITFIELD_MOCK, 2, 1) == 0x7UL);
+                        REQUIRE (MOCK_ARG_HISTORY(SET_BITFIELD_MOCK, 3, 1) == 4UL);
+                    }
+
+                    AND_THEN ("the channel shall be the only conversion of the sequence")
+                    {
+                        REQUIRE (MOCK_NEXT_CALLED_FUNCTION_IS(SET_BITFIELD_MOCK));
+                        REQUIRE (MOCK_NEXT_CALLED_FUNCTION_IS(SET_BITFIELD_MOCK));
+                        REQUIRE (MOCK_ARG_HISTORY(SET_BITFIELD_MOCK, 0, 2) == &ADC1->SQR1);
+                        REQUIRE (MOCK_ARG_HISTORY(SET_BITFIELD_MOCK, 1, 2) == ADC_SQR1_L_Pos);
+                        REQUIRE (MOCK_ARG_HISTORY(SET_BITFIELD_MOCK, 3, 2) == 0UL);
+                        REQUIRE (MOCK_NEXT_CALLED_FUNCTION_IS(SET_BITFIELD_MOCK));
+                        REQUIRE (MOCK_ARG_HISTORY(SET_BITFIELD_MOCK, 0, 3) == &ADC1->SQR3);
+                        REQUIRE (MOCK_ARG_HISTORY(SET_BITFIELD_MOCK, 1, 3) == ADC_SQR3_SQ1_Pos);
+                        REQUIRE (MOCK_ARG_HISTORY(SET_BITFIELD_MOCK, 3, 3) == channel);
+
+                        AND_THEN ("the end of conversion interrupt shall be enabled")
+                        {
+                            REQUIRE (MOCK_NEXT_CALLED_FUNCTION_IS(SET_BIT_MOCK));
+                            REQUIRE (MOCK_ARG_HISTORY(SET_BIT_MOCK, 0, 0) == &ADC1->CR1);
+                            REQUIRE (MOCK_ARG_HISTORY(SET_BIT_MOCK, 1, 0) == ADC_CR1_EOCIE_Pos);
+                        }
+
+                        AND_THEN ("the conversion shall be started by software after the cycle counter is read")
+                        {
+                            REQUIRE (MOCK_NEXT_CALLED_FUNCTION_IS(SET_BIT_MOCK));
+                            REQUIRE (MOCK_NEXT_CALLED_FUNCTION_IS(REG_READ_MOCK));
+                            REQUIRE (MOCK_LAST_ARG(REG_READ_MOCK, 0) == &DWT->CYCCNT);
+                            REQUIRE (MOCK_NEXT_CALLED_FUNCTION_IS(SET_BIT_MOCK));
+                            REQUIRE (MOCK_LAST_ARG(SET_BIT_MOCK, 0) == &ADC1->CR2);
+                            REQUIRE (MOCK_LAST_ARG(SET_BIT_MOCK, 1) == ADC_CR2_SWSTART_Pos);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("ADC conversion start fails", "[hal][adc][error_handling]")
+{
+    GIVEN ("a channel is configured")
+    {
+        Helper_InitAdc();
+        Helper_ConfigureChannel(ADC_CHANNEL_5, ADC_RES_12_BIT);
+
+        WHEN ("a conversion is started on an invalid channel")
+        {
+            Error_t error = HalAdc_StartConversion(ADC_CHANNEL_COUNT);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+
+        WHEN ("a conversion is started on an unconfigured channel")
+        {
+            Error_t error = HalAdc_StartConversion(ADC_CHANNEL_6);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+
+        WHEN ("a conversion is started while another one is running")
+        {
+            REQUIRE (HalAdc_StartConversion(ADC_CHANNEL_5) == ERROR_OK);
+            HAL_MOCK_RESET();
+            Error_t error = HalAdc_StartConversion(ADC_CHANNEL_5);
+
+            THEN ("the ADC shall not be available and the running conversion shall not be touched")
+            {
+                REQUIRE (error == ERROR_RESOURCE_NOT_AVAILABLE);
+                REQUIRE (NO_ASSERT_ERRORS);
+                REQUIRE (MOCK_CALLS(SET_BIT_MOCK) == 0);
+                REQUIRE (MOCK_CALLS(SET_BITFIELD_MOCK) == 0);
+            }
+        }
+    }
+}
+
+//------------------------------------
+// ADC_IRQHandler
+//------------------------------------
+
+SCENARIO ("ADC conversion completes", "[hal][adc]")
+{
+    GIVEN ("a conversion is started")
+    {
+        Helper_InitAdc();
+        Helper_ConfigureChannel(ADC_CHANNEL_7, ADC_RES_12_BIT);
+        cycleCounter = 0xFFFFFF00UL;
+        REQUIRE (HalAdc_StartConversion(ADC_CHANNEL_7) == ERROR_OK);
+
+        WHEN ("the end of conversion interrupt occurs")
+        {
+            dataRegister = 0xABCUL;
+            cycleCounter = 0x00000100UL;
+            MOCK_SET_RETURN_VALUE(GET_BIT_MOCK, true);
+            ADC_IRQHandler();
+
+            THEN ("the end of conversion flag shall be checked")
+            {
+                REQUIRE (MOCK_LAST_ARG(GET_BIT_MOCK, 0) == &ADC1->SR);
+                REQUIRE (MOCK_LAST_ARG(GET_BIT_MOCK, 1) == ADC_SR_EOC_Pos);
+
+                AND_THEN ("the result shall be passed to the callback")
+                {
+                    REQUIRE (callbackCalls == 1UL);
+                    REQUIRE (callbackResult == 0xABCU);
+
+                    AND_THEN ("the latency shall be measured over a cycle counter wrap-around")
+                    {
+                        REQUIRE (HalAdc_GetMaxLatencyCycles() == 0x200UL);
+
+                        AND_THEN ("the next conversion can be started")
+                        {
+                            REQUIRE (HalAdc_StartConversion(ADC_CHANNEL_7) == ERROR_OK);
+                        }
+                    }
+                }
+            }
+        }
+
+        WHEN ("the interrupt occurs without a completed conversion")
+        {
+            MOCK_SET_RETURN_VALUE(GET_BIT_MOCK, false);
+            ADC_IRQHandler();
+
+            THEN ("the callback shall not be called and the conversion shall keep running")
+            {
+                REQUIRE (callbackCalls == 0UL);
+                REQUIRE (HalAdc_StartConversion(ADC_CHANNEL_7) == ERROR_RESOURCE_NOT_AVAILABLE);
+            }
+        }
+    }
+
+    GIVEN ("conversions of different latencies have completed")
+    {
+        Helper_InitAdc();
+        Helper_ConfigureChannel(ADC_CHANNEL_0, ADC_RES_12_BIT);
+        MOCK_SET_RETURN_VALUE(GET_BIT_MOCK, true);
+        const uint32_t aLatencies[] = {300UL, 900UL, 500UL};
+        for (uint32_t latency : aLatencies)
+        {
+            cycleCounter = 1000UL;
+            REQUIRE (HalAdc_StartConversion(ADC_CHANNEL_0) == ERROR_OK);
+            cycleCounter += latency;
+            ADC_IRQHandler();
+        }
+
+        WHEN ("the maximum latency is read")
+        {
+            uint32_t maxLatency = HalAdc_GetMaxLatencyCycles();
+
+            THEN ("it shall be the longest latency")
+            {
+                REQUIRE (maxLatency == 900UL);
+            }
+        }
+    }
+
+    GIVEN ("the callback starts the next conversion")
+    {
+        Helper_InitAdc();
+        AdcConfig_t config = {.channel = ADC_CHANNEL_2, .resolution = ADC_RES_12_BIT, .Callback = Helper_RestartingCallback};
+        HalAdc_SetConfiguration(&config);
+        REQUIRE (HalAdc_StartConversion(ADC_CHANNEL_2) == ERROR_OK);
+
+        WHEN ("the end of conversion interrupt occurs")
+        {
+            MOCK_SET_RETURN_VALUE(GET_BIT_MOCK, true);
+            ADC_IRQHandler();
+
+            THEN ("the next conversion shall be started")
+            {
+                REQUIRE (callbackCalls == 1UL);
+                REQUIRE (NO_ASSERT_ERRORS);
+                REQUIRE (isConverting == true);
+            }
+        }
+    }
+}
+
+//------------------------------------
+// HalAdc_GetConversionCycles
+//------------------------------------
+
+SCENARIO ("ADC conversion time is calculated", "[hal][adc]")
+{
+    GIVEN ("the ADC is not configured")
+    {
+        Helper_InitAdc();
+
+        WHEN ("the conversion times of the resolutions and sample times are calculated")
+        {
+            uint32_t cycles12Bit = HalAdc_GetConversionCycles(ADC_RES_12_BIT, ADC_SAMPLE_TIME_3_CYCLES);
+            uint32_t cycles10Bit = HalAdc_GetConversionCycles(ADC_RES_10_BIT, ADC_SAMPLE_TIME_84_CYCLES);
+            uint32_t cycles8Bit = HalAdc_GetConversionCycles(ADC_RES_8_BIT, ADC_SAMPLE_TIME_480_CYCLES);
+
+            THEN ("each shall be the sample time plus one cycle per bit")
+            {
+                REQUIRE (cycles12Bit == 15UL);
+                REQUIRE (cycles10Bit == 94UL);
+                REQUIRE (cycles8Bit == 488UL);
+                REQUIRE (NO_ASSERT_ERRORS);
+            }
+        }
+
+        WHEN ("the conversion time of an invalid sample time is calculated")
+        {
+            uint32_t cycles = HalAdc_GetConversionCycles(ADC_RES_12_BIT, ADC_SAMPLE_TIME_COUNT);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (cycles == 0UL);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+    }
+
+    GIVEN ("the full scales of the resolutions")
+    {
+        THEN ("they shall be available at compile time")
+        {
+            STATIC_REQUIRE (ADC_MAX_VALUE(ADC_RES_12_BIT) == 0xFFFUL);
+            STATIC_REQUIRE (ADC_MAX_VALUE(ADC_RES_10_BIT) == 0x3FFUL);
+            STATIC_REQUIRE (ADC_MAX_VALUE(ADC_RES_8_BIT) == 0xFFUL);
+        }
+    }
+}
+
+//------------------------------------
+// HalAdc_SetInjectedConfiguration
+//------------------------------------
+
+SCENARIO ("ADC injected sequence is configured", "[hal][adc][injected]")
+{
+    GIVEN ("a scan is running")
+    {
+        Helper_InitAdc();
+        Helper_UseRegisterModel();
+        AdcScanConfig_t scanConfig = Helper_ScanConfig();
+        REQUIRE (HalAdc_StartScan(&scanConfig) == ERROR_OK);
+        ADC1->SMPR1 = 0UL;
+        ADC1->SMPR2 = 0UL;
+
+        WHEN ("an injected sequence of channels 12 and 3 is configured")
+        {
+            AdcInjectedConfig_t config = {.pChannels = aInjectedChannels, .channelCount = 2UL};
+            Error_t error = HalAdc_SetInjectedConfiguration(&config);
+
+            THEN ("no errors shall occur")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (NO_ASSERT_ERRORS);
+
+                AND_THEN ("the sequence shall be of two conversions ending at the fourth position")
+                {
+                    REQUIRE ((ADC1->JSQR & ADC_JSQR_JL_Msk) == (1UL << ADC_JSQR_JL_Pos));
+                    REQUIRE ((ADC1->JSQR & ADC_JSQR_JSQ3_Msk) == ((uint32_t)ADC_CHANNEL_12 << ADC_JSQR_JSQ3_Pos));
+                    REQUIRE ((ADC1->JSQR & ADC_JSQR_JSQ4_Msk) == ((uint32_t)ADC_CHANNEL_3 << ADC_JSQR_JSQ4_Pos));
+                    REQUIRE ((ADC1->SMPR1 & ADC_SMPR1_SMP12_Msk) == (4UL << ADC_SMPR1_SMP12_Pos));
+                    REQUIRE ((ADC1->SMPR2 & ADC_SMPR2_SMP3_Msk) == (1UL << ADC_SMPR2_SMP3_Pos));
+
+                    AND_THEN ("the injected interrupt shall be enabled without disturbing the scan")
+                    {
+                        REQUIRE (Helper_IsBitSet(ADC1->CR1, ADC_CR1_JEOCIE_Pos));
+                        REQUIRE (Helper_IsBitSet(ADC1->CR1, ADC_CR1_EOCIE_Pos) == false);
+                        REQUIRE (Helper_IsBitSet(ADC1->CR2, ADC_CR2_ADON_Pos));
+                        REQUIRE (Helper_IsBitSet(ADC1->CR2, ADC_CR2_DMA_Pos));
+                        REQUIRE (MOCK_LAST_ARG(NVIC_EnableIRQ, 0) == ADC_IRQn);
+                    }
+                }
+            }
+        }
+
+        WHEN ("an injected sequence of all four channels is configured")
+        {
+            AdcInjectedConfig_t config = {.pChannels = aInjectedChannels, .channelCount = ADC_INJECTED_MAX_CHANNELS};
+            Error_t error = HalAdc_SetInjectedConfiguration(&config);
+
+            THEN ("the sequence shall start from the first position")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE ((ADC1->JSQR & ADC_JSQR_JL_Msk) == (3UL << ADC_JSQR_JL_Pos));
+                REQUIRE ((ADC1->JSQR & ADC_JSQR_JSQ1_Msk) == ((uint32_t)ADC_CHANNEL_12 << ADC_JSQR_JSQ1_Pos));
+                REQUIRE ((ADC1->JSQR & ADC_JSQR_JSQ4_Msk) == ((uint32_t)ADC_CHANNEL_18 << ADC_JSQR_JSQ4_Pos));
+            }
+        }
+    }
+}
+
+SCENARIO ("ADC injected configuration fails", "[hal][adc][injected][error_handling]")
+{
+    GIVEN ("the ADC is not configured")
+    {
+        Helper_InitAdc();
+        AdcInjectedConfig_t config = {.pChannels = aInjectedChannels, .channelCount = 2UL};
+
+        WHEN ("an injected sequence is configured with a null configuration")
+        {
+            Error_t error = HalAdc_SetInjectedConfiguration(NULL);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+
+        WHEN ("an injected sequence is configured with too many channels")
+        {
+            config.channelCount = ADC_INJECTED_MAX_CHANNELS + 1UL;
+            Error_t error = HalAdc_SetInjectedConfiguration(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+            }
+        }
+
+        WHEN ("an injected sequence is configured without channels")
+        {
+            config.channelCount = 0UL;
+            Error_t error = HalAdc_SetInjectedConfiguration(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+            }
+        }
+
+        WHEN ("an injected sequence is configured with an invalid channel")
+        {
+            AdcInjectedChannel_t aChannels[] =
+            {
+                aInjectedChannels[0], {ADC_CHANNEL_COUNT, ADC_SAMPLE_TIME_3_CYCLES, Helper_RecordingCallback}
+            };
+            config.pChannels = aChannels;
+            Error_t error = HalAdc_SetInjectedConfiguration(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+            }
+        }
+
+        WHEN ("an injected sequence is configured with a channel without a callback")
+        {
+            AdcInjectedChannel_t aChannels[] = {aInjectedChannels[0], {ADC_CHANNEL_3, ADC_SAMPLE_TIME_3_CYCLES, NULL}};
+            config.pChannels = aChannels;
+            Error_t error = HalAdc_SetInjectedConfiguration(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+            }
+        }
+
+        WHEN ("an injected conversion is started without a sequence")
+        {
+            Error_t error = HalAdc_StartInjectedConversion();
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+    }
+}
+
+//------------------------------------
+// HalAdc_StartInjectedConversion
+//------------------------------------
+
+SCENARIO ("ADC injected conversion is started", "[hal][adc][injected]")
+{
+    GIVEN ("an injected sequence is configured")
+    {
+        Helper_InitAdc();
+        Helper_UseRegisterModel();
+        AdcInjectedConfig_t config = {.pChannels = aInjectedChannels, .channelCount = 2UL};
+        REQUIRE (HalAdc_SetInjectedConfiguration(&config) == ERROR_OK);
+
+        WHEN ("an injected conversion is started during a single conversion")
+        {
+            Helper_ConfigureChannel(ADC_CHANNEL_5, ADC_RES_12_BIT);
+            REQUIRE (HalAdc_StartConversion(ADC_CHANNEL_5) == ERROR_OK);
+            Error_t error = HalAdc_StartInjectedConversion();
+
+            THEN ("the injected sequence shall be started by software in the scan mode")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (NO_ASSERT_ERRORS);
+                REQUIRE (isInjectedConverting);
+                REQUIRE (Helper_IsBitSet(ADC1->CR1, ADC_CR1_SCAN_Pos));
+                REQUIRE (Helper_IsBitSet(ADC1->CR2, ADC_CR2_JSWSTART_Pos));
+
+                AND_WHEN ("another injected conversion or a new sequence is started before the end")
+                {
+                    Error_t startError = HalAdc_StartInjectedConversion();
+                    Error_t configurationError = HalAdc_SetInjectedConfiguration(&config);
+
+                    THEN ("the injected sequence shall not be started or changed")
+                    {
+                        REQUIRE (startError == ERROR_RESOURCE_NOT_AVAILABLE);
+                        REQUIRE (configurationError == ERROR_RESOURCE_NOT_AVAILABLE);
+                        REQUIRE (NO_ASSERT_ERRORS);
+                    }
+                }
+            }
+        }
+
+        WHEN ("an injected conversion is started during a capture")
+        {
+            AdcCaptureConfig_t captureConfig = Helper_CaptureConfig();
+            REQUIRE (HalAdc_StartCapture(&captureConfig) == ERROR_OK);
+            Error_t error = HalAdc_StartInjectedConversion();
+
+            THEN ("the injected sequence shall not be started")
+            {
+                REQUIRE (error == ERROR_RESOURCE_NOT_AVAILABLE);
+                REQUIRE (isInjectedConverting == false);
+            }
+        }
+    }
+}
+
+SCENARIO ("ADC injected conversion completes", "[hal][adc][injected]")
+{
+    GIVEN ("an injected conversion is started during a scan")
+    {
+        Helper_InitAdc();
+        Helper_UseRegisterModel();
+        AdcScanConfig_t scanConfig = Helper_ScanConfig();
+        REQUIRE (HalAdc_StartScan(&scanConfig) == ERROR_OK);
+        AdcInjectedConfig_t config = {.pChannels = aInjectedChannels, .channelCount = 2UL};
+        REQUIRE (HalAdc_SetInjectedConfiguration(&config) == ERROR_OK);
+        REQUIRE (HalAdc_StartInjectedConversion() == ERROR_OK);
+
+        WHEN ("the injected end of conversion interrupt occurs")
+        {
+            ADC1->JDR1 = 0xABCUL;
+            ADC1->JDR2 = 0x123UL;
+            ADC1->SR = ADC_SR_JEOC | ADC_SR_EOC;
+            ADC_IRQHandler();
+
+            THEN ("each result shall be passed to the callback of its channel")
+            {
+                REQUIRE (callbackCalls == 1UL);
+                REQUIRE (callbackResult == 0xABCU);
+                REQUIRE (injectedCalls == 1UL);
+                REQUIRE (aInjectedResults[0] == 0x123U);
+                REQUIRE (NO_ASSERT_ERRORS);
+
+                AND_THEN ("the injected conversion shall be completed and the scan shall go on")
+                {
+                    REQUIRE (isInjectedConverting == false);
+                    REQUIRE (Helper_IsBitSet(ADC1->SR, ADC_SR_JEOC_Pos) == false);
+                    REQUIRE (isScanning);
+                    REQUIRE (blockCalls == 0UL);
+                    REQUIRE (HalAdc_StartInjectedConversion() == ERROR_OK);
+                }
+            }
+        }
+
+        WHEN ("the ADC interrupt occurs for the regular conversions only")
+        {
+            ADC1->SR = ADC_SR_EOC;
+            ADC_IRQHandler();
+
+            THEN ("no injected results shall be passed")
+            {
+                REQUIRE (callbackCalls == 0UL);
+                REQUIRE (injectedCalls == 0UL);
+                REQUIRE (isInjectedConverting);
+            }
+        }
+    }
+}
+
+//------------------------------------
+// HalAdc_StartScan
+//------------------------------------
+
+SCENARIO ("ADC scan is started", "[hal][adc][scan]")
+{
+    GIVEN ("a channel is configured for single conversions")
+    {
+        Helper_InitAdc();
+        Helper_ConfigureChannel(ADC_CHANNEL_5, ADC_RES_12_BIT);
+        Helper_UseRegisterModel();
+        AdcScanConfig_t config = Helper_ScanConfig();
+
+        WHEN ("a scan of 16 channels is started")
+        {
+            Error_t error = HalAdc_StartScan(&config);
+
+            THEN ("no errors shall occur")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (NO_ASSERT_ERRORS);
+
+                AND_THEN ("the DMA stream shall move the results into the circular buffer")
+                {
+                    REQUIRE (Helper_IsBitSet(RCC->AHB1ENR, RCC_AHB1ENR_DMA2EN_Pos));
+                    REQUIRE (DMA2_Stream0->PAR == (uint32_t)(uintptr_t)&ADC1->DR);
+                    REQUIRE (DMA2_Stream0->M0AR == (uint32_t)(uintptr_t)aScanBuffer);
+                    REQUIRE (DMA2_Stream0->NDTR == ARRAY_LENGTH(aScanBuffer, uint16_t));
+                    REQUIRE (DMA2_Stream0->CR == (DMA_SxCR_PL_1 | DMA_SxCR_MSIZE_0 | DMA_SxCR_PSIZE_0 | DMA_SxCR_MINC |
+                                                  DMA_SxCR_CIRC | DMA_SxCR_HTIE | DMA_SxCR_TCIE | DMA_SxCR_TEIE |
+                                                  DMA_SxCR_EN));
+                    REQUIRE (NVIC_EnableIRQ_fake.arg0_history[NVIC_EnableIRQ_fake.call_count - 1U] ==
+                             DMA2_Stream0_IRQn);
+
+                    AND_THEN ("the ADC shall convert the channels in order")
+                    {
+                        REQUIRE (Helper_IsBitSet(ADC1->CR1, ADC_CR1_SCAN_Pos));
+                        REQUIRE (Helper_IsBitSet(ADC1->CR1, ADC_CR1_EOCIE_Pos) == false);
+                        REQUIRE (((ADC1->CR1 & ADC_CR1_RES_Msk) >> ADC_CR1_RES_Pos) == ADC_RES_10_BIT);
+                        REQUIRE (((ADC1->SQR1 & ADC_SQR1_L_Msk) >> ADC_SQR1_L_Pos) == 15UL);
+                        REQUIRE (((ADC1->SQR3 & ADC_SQR3_SQ1_Msk) >> ADC_SQR3_SQ1_Pos) == ADC_CHANNEL_15);
+                        REQUIRE (((ADC1->SQR3 & ADC_SQR3_SQ6_Msk) >> ADC_SQR3_SQ6_Pos) == ADC_CHANNEL_10);
+                        REQUIRE (((ADC1->SQR2 & ADC_SQR2_SQ7_Msk) >> ADC_SQR2_SQ7_Pos) == ADC_CHANNEL_9);
+                        REQUIRE (((ADC1->SQR2 & ADC_SQR2_SQ12_Msk) >> ADC_SQR2_SQ12_Pos) == ADC_CHANNEL_4);
+                        REQUIRE (((ADC1->SQR1 & ADC_SQR1_SQ13_Msk) >> ADC_SQR1_SQ13_Pos) == ADC_CHANNEL_3);
+                        REQUIRE (((ADC1->SQR1 & ADC_SQR1_SQ16_Msk) >> ADC_SQR1_SQ16_Pos) == ADC_CHANNEL_0);
+                        REQUIRE (ADC1->SMPR1 == 0x00024924UL);
+                        REQUIRE (ADC1->SMPR2 == 0x24924924UL);
+
+                        AND_THEN ("the ADC shall convert continuously with DMA requests after the software start")
+                        {
+                            REQUIRE (Helper_IsBitSet(ADC1->CR2, ADC_CR2_DMA_Pos));
+                            REQUIRE (Helper_IsBitSet(ADC1->CR2, ADC_CR2_DDS_Pos));
+                            REQUIRE (Helper_IsBitSet(ADC1->CR2, ADC_CR2_CONT_Pos));
+                            REQUIRE (SET_BIT_MOCK_fake.arg0_val == &ADC1->CR2);
+                            REQUIRE (SET_BIT_MOCK_fake.arg1_val == ADC_CR2_SWSTART_Pos);
+
+                            AND_THEN ("the ADC shall not be available for single conversions or another scan")
+                            {
+                                REQUIRE (HalAdc_StartConversion(ADC_CHANNEL_5) == ERROR_RESOURCE_NOT_AVAILABLE);
+                                REQUIRE (HalAdc_StartScan(&config) == ERROR_RESOURCE_NOT_AVAILABLE);
+                            }
+
+                            AND_WHEN ("a channel is configured during the scan")
+                            {
+                                Helper_ConfigureChannel(ADC_CHANNEL_6, ADC_RES_12_BIT);
+
+                                THEN ("the end of conversion interrupt shall stay disabled")
+                                {
+                                    REQUIRE (Helper_IsBitSet(ADC1->CR1, ADC_CR1_EOCIE_Pos) == false);
+                                    REQUIRE (Helper_IsBitSet(ADC1->CR1, ADC_CR1_SCAN_Pos));
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("ADC scan is triggered by a timer", "[hal][adc][scan]")
+{
+    GIVEN ("a scan configuration with a TIM3 trigger at 1 kHz")
+    {
+        Helper_InitAdc();
+        Helper_UseRegisterModel();
+        AdcScanConfig_t config = Helper_ScanConfig();
+        config.trigger = ADC_TRIGGER_TIM3_TRGO;
+        config.scanRate = 1000UL;
+
+        WHEN ("the scan is started")
+        {
+            Error_t error = HalAdc_StartScan(&config);
+
+            THEN ("no errors shall occur")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (NO_ASSERT_ERRORS);
+
+                AND_THEN ("each rising edge of TIM3 TRGO shall start one scan instead of the software")
+                {
+                    REQUIRE (((ADC1->CR2 & ADC_CR2_EXTSEL_Msk) >> ADC_CR2_EXTSEL_Pos) == 8UL);
+                    REQUIRE (((ADC1->CR2 & ADC_CR2_EXTEN_Msk) >> ADC_CR2_EXTEN_Pos) == 1UL);
+                    REQUIRE (Helper_IsBitSet(ADC1->CR2, ADC_CR2_CONT_Pos) == false);
+                    REQUIRE (Helper_IsBitSet(ADC1->CR2, ADC_CR2_SWSTART_Pos) == false);
+                    REQUIRE (Helper_IsBitSet(ADC1->CR2, ADC_CR2_DMA_Pos));
+
+                    AND_THEN ("TIM3 shall run at 1 kHz with TRGO on the update event")
+                    {
+                        REQUIRE (Helper_IsBitSet(RCC->APB1ENR, RCC_APB1ENR_TIM3EN_Pos));
+                        REQUIRE (TIM3->PSC == 0UL);
+                        REQUIRE (TIM3->ARR == 15999UL);
+                        REQUIRE (TIM3->EGR == TIM_EGR_UG);
+                        REQUIRE (((TIM3->CR2 & TIM_CR2_MMS_Msk) >> TIM_CR2_MMS_Pos) == 2UL);
+                        REQUIRE (Helper_IsBitSet(TIM3->CR1, TIM_CR1_CEN_Pos));
+                    }
+                }
+            }
+        }
+
+        WHEN ("the scan is started and stopped")
+        {
+            REQUIRE (HalAdc_StartScan(&config) == ERROR_OK);
+            Error_t error = HalAdc_StopScan();
+
+            THEN ("the timer and the external trigger shall be stopped")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (Helper_IsBitSet(TIM3->CR1, TIM_CR1_CEN_Pos) == false);
+                REQUIRE ((TIM3->CR2 & TIM_CR2_MMS_Msk) == 0UL);
+                REQUIRE (((ADC1->CR2 & ADC_CR2_EXTEN_Msk) >> ADC_CR2_EXTEN_Pos) == 0UL);
+                REQUIRE (pTriggerTimer == NULL);
+            }
+        }
+    }
+
+    GIVEN ("a scan configuration with a TIM3 trigger at 1 kHz and the APB1 clock at a quarter of HCLK")
+    {
+        Helper_InitAdc();
+        Helper_UseRegisterModel();
+        RCC->CFGR = RCC_CFGR_PPRE1_DIV4;
+        AdcScanConfig_t config = Helper_ScanConfig();
+        config.trigger = ADC_TRIGGER_TIM3_TRGO;
+        config.scanRate = 1000UL;
+
+        WHEN ("the scan is started")
+        {
+            Error_t error = HalAdc_StartScan(&config);
+
+            THEN ("the timer period shall be counted at twice the APB1 clock")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (TIM3->PSC == 0UL);
+                REQUIRE (TIM3->ARR == 7999UL);
+            }
+        }
+    }
+
+    GIVEN ("a scan configuration with a TIM8 trigger at 10 Hz and the APB2 clock at a sixteenth of HCLK")
+    {
+        Helper_InitAdc();
+        Helper_UseRegisterModel();
+        RCC->CFGR = RCC_CFGR_PPRE2_DIV16;
+        AdcScanConfig_t config = Helper_ScanConfig();
+        config.trigger = ADC_TRIGGER_TIM8_TRGO;
+        config.scanRate = 10UL;
+
+        WHEN ("the scan is started")
+        {
+            Error_t error = HalAdc_StartScan(&config);
+
+            THEN ("the timer period shall be counted at twice the APB2 clock")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (TIM8->PSC == 3UL);
+                REQUIRE (TIM8->ARR == 49999UL);
+            }
+        }
+    }
+
+    GIVEN ("a scan configuration with a TIM3 trigger that has been started and stopped")
+    {
+        Helper_InitAdc();
+        Helper_UseRegisterModel();
+        AdcScanConfig_t config = Helper_ScanConfig();
+        config.trigger = ADC_TRIGGER_TIM3_TRGO;
+        config.scanRate = 1000UL;
+        REQUIRE (HalAdc_StartScan(&config) == ERROR_OK);
+        REQUIRE (HalAdc_StopScan() == ERROR_OK);
+
+        WHEN ("the scan is started again")
+        {
+            MOCK_SET_CUSTOM_FAKE(REG_WRITE_MOCK, REG_WRITE_UpdateTrigger);
+            Error_t error = HalAdc_StartScan(&config);
+
+            THEN ("the update generation of the timer shall not trigger a conversion")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (TIM3->EGR == TIM_EGR_UG);
+                REQUIRE (updateTriggers == 0UL);
+                REQUIRE (((TIM3->CR2 & TIM_CR2_MMS_Msk) >> TIM_CR2_MMS_Pos) == 2UL);
+            }
+        }
+    }
+
+    {
+        Helper_InitAdc();
+        Helper_UseRegisterModel();
+        AdcScanConfig_t config = Helper_ScanConfig();
+        config.trigger = ADC_TRIGGER_TIM8_TRGO;
+        config.scanRate = 10UL;
+
+        WHEN ("the scan is started")
+        {
+            Error_t error = HalAdc_StartScan(&config);
+
+            THEN ("the timer period shall be split into a prescaler and an auto-reload value")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (((ADC1->CR2 & ADC_CR2_EXTSEL_Msk) >> ADC_CR2_EXTSEL_Pos) == 14UL);
+                REQUIRE (Helper_IsBitSet(RCC->APB2ENR, RCC_APB2ENR_TIM8EN_Pos));
+                REQUIRE (TIM8->PSC == 24UL);
+                REQUIRE (TIM8->ARR == 63999UL);
+                REQUIRE (Helper_IsBitSet(TIM8->CR1, TIM_CR1_CEN_Pos));
+            }
+        }
+    }
+
+    GIVEN ("a scan configuration with a TIM2 trigger at 1 Hz")
+    {
+        Helper_InitAdc();
+        Helper_UseRegisterModel();
+        AdcScanConfig_t config = Helper_ScanConfig();
+        config.trigger = ADC_TRIGGER_TIM2_TRGO;
+        config.scanRate = 1UL;
+
+        WHEN ("the scan is started")
+        {
+            Error_t error = HalAdc_StartScan(&config);
+
+            THEN ("the timer period shall be within a prescaler step of one second")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (((ADC1->CR2 & ADC_CR2_EXTSEL_Msk) >> ADC_CR2_EXTSEL_Pos) == 6UL);
+                REQUIRE (Helper_IsBitSet(RCC->APB1ENR, RCC_APB1ENR_TIM2EN_Pos));
+                REQUIRE (TIM2->PSC < 0x10000UL);
+                REQUIRE (TIM2->ARR < 0x10000UL);
+                uint32_t period = (TIM2->PSC + 1UL) * (TIM2->ARR + 1UL);
+                REQUIRE (period <= SystemCoreClock);
+                REQUIRE (period > (SystemCoreClock - (TIM2->PSC + 1UL)));
+            }
+        }
+    }
+
+    GIVEN ("a scan configuration of 8-bit results with the shortest sample time and a TIM3 trigger at 2 kHz")
+    {
+        Helper_InitAdc();
+        Helper_UseRegisterModel();
+        AdcScanConfig_t config = Helper_ScanConfig();
+        config.resolution = ADC_RES_8_BIT;
+        config.sampleTime = ADC_SAMPLE_TIME_3_CYCLES;
+        config.trigger = ADC_TRIGGER_TIM3_TRGO;
+        config.scanRate = 2000UL;
+
+        WHEN ("the scan is started")
+        {
+            Error_t error = HalAdc_StartScan(&config);
+
+            THEN ("the scan shall fit into the trigger period")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (NO_ASSERT_ERRORS);
+                REQUIRE ((ADC1->CR1 & ADC_CR1_RES_Msk) == ((uint32_t)ADC_RES_8_BIT << ADC_CR1_RES_Pos));
+                REQUIRE (ADC1->SMPR1 == 0UL);
+                REQUIRE (ADC1->SMPR2 == 0UL);
+                REQUIRE (TIM3->ARR == 7999UL);
+            }
+        }
+    }
+}
+
+SCENARIO ("ADC scan start fails", "[hal][adc][scan][error_handling]")
+{
+    GIVEN ("the ADC is not configured")
+    {
+        Helper_InitAdc();
+        AdcScanConfig_t config = Helper_ScanConfig();
+        AdcChannel_t aInvalidChannels[] = {ADC_CHANNEL_0, ADC_CHANNEL_COUNT};
+
+        WHEN ("a scan is started with a null configuration")
+        {
+            Error_t error = HalAdc_StartScan(NULL);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+
+        WHEN ("a scan is started with too many channels")
+        {
+            config.channelCount = ADC_SCAN_MAX_CHANNELS + 1UL;
+            Error_t error = HalAdc_StartScan(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+
+        WHEN ("a scan is started with an invalid channel")
+        {
+            config.pChannels = aInvalidChannels;
+            config.channelCount = ARRAY_LENGTH(aInvalidChannels, AdcChannel_t);
+            Error_t error = HalAdc_StartScan(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+
+        WHEN ("a scan is started with a buffer that does not split into two blocks of whole scans")
+        {
+            config.bufferLength = 24UL;
+            Error_t error = HalAdc_StartScan(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+
+        WHEN ("a scan is started with an invalid trigger")
+        {
+            config.trigger = ADC_TRIGGER_COUNT;
+            Error_t error = HalAdc_StartScan(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+
+        WHEN ("a timer triggered scan is started without a scan rate")
+        {
+            config.trigger = ADC_TRIGGER_TIM2_TRGO;
+            config.scanRate = 0UL;
+            Error_t error = HalAdc_StartScan(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+
+        WHEN ("a timer triggered scan is started at a rate the conversions cannot keep up with")
+        {
+            // 16 channels of 84 + 10 ADC clock cycles take up to 12032 CPU cycles, but 2 kHz gives 8000.
+            config.trigger = ADC_TRIGGER_TIM2_TRGO;
+            config.scanRate = 2000UL;
+            Error_t error = HalAdc_StartScan(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+
+        WHEN ("a scan is started with an invalid sample time")
+        {
+            config.sampleTime = ADC_SAMPLE_TIME_COUNT;
+            Error_t error = HalAdc_StartScan(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+            }
+        }
+
+        WHEN ("a scan is started without a callback")
+        {
+            config.Callback = NULL;
+            Error_t error = HalAdc_StartScan(&config);
+
+            THEN ("assert error shall occur and the scan shall not run")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+                REQUIRE (isScanning == false);
+            }
+        }
+    }
+
+    GIVEN ("a conversion is running")
+    {
+        Helper_InitAdc();
+        Helper_ConfigureChannel(ADC_CHANNEL_5, ADC_RES_12_BIT);
+        REQUIRE (HalAdc_StartConversion(ADC_CHANNEL_5) == ERROR_OK);
+        AdcScanConfig_t config = Helper_ScanConfig();
+
+        WHEN ("a scan is started")
+        {
+            Error_t error = HalAdc_StartScan(&config);
+
+            THEN ("the ADC shall not be available")
+            {
+                REQUIRE (error == ERROR_RESOURCE_NOT_AVAILABLE);
+                REQUIRE (NO_ASSERT_ERRORS);
+                REQUIRE (isScanning == false);
+            }
+        }
+    }
+}
+
+//------------------------------------
+// DMA2_Stream0_IRQHandler
+//------------------------------------
+
+SCENARIO ("ADC scan blocks are completed", "[hal][adc][scan]")
+{
+    GIVEN ("a scan is running")
+    {
+        Helper_InitAdc();
+        Helper_UseRegisterModel();
+        AdcScanConfig_t config = Helper_ScanConfig();
+        REQUIRE (HalAdc_StartScan(&config) == ERROR_OK);
+        DMA2->LIFCR = 0UL;
+
+        WHEN ("the half transfer interrupt occurs")
+        {
+            DMA2->LISR = DMA_LISR_HTIF0;
+            DMA2_Stream0_IRQHandler();
+
+            THEN ("the first half of the buffer shall be passed to the callback and the flag shall be cleared")
+            {
+                REQUIRE (blockCalls == 1UL);
+                REQUIRE (apBlocks[0] == &aScanBuffer[0]);
+                REQUIRE (aBlockLengths[0] == 16UL);
+                REQUIRE (DMA2->LIFCR == DMA_LIFCR_CHTIF0);
+                REQUIRE (NO_ASSERT_ERRORS);
+            }
+        }
+
+        WHEN ("the transfer complete interrupt occurs")
+        {
+            DMA2->LISR = DMA_LISR_TCIF0;
+            DMA2_Stream0_IRQHandler();
+
+            THEN ("the second half of the buffer shall be passed to the callback and the flag shall be cleared")
+            {
+                REQUIRE (blockCalls == 1UL);
+                REQUIRE (apBlocks[0] == &aScanBuffer[16]);
+                REQUIRE (aBlockLengths[0] == 16UL);
+                REQUIRE (DMA2->LIFCR == DMA_LIFCR_CTCIF0);
+            }
+        }
+
+        WHEN ("the interrupt is late and both halves are ready")
+        {
+            DMA2->LISR = DMA_LISR_HTIF0 | DMA_LISR_TCIF0;
+            DMA2_Stream0_IRQHandler();
+
+            THEN ("both halves shall be passed to the callback in order")
+            {
+                REQUIRE (blockCalls == 2UL);
+                REQUIRE (apBlocks[0] == &aScanBuffer[0]);
+                REQUIRE (apBlocks[1] == &aScanBuffer[16]);
+            }
+        }
+
+        WHEN ("the transfer error interrupt occurs")
+        {
+            DMA2->LISR = DMA_LISR_TEIF0;
+            DMA2_Stream0_IRQHandler();
+
+            THEN ("an ADC error shall be raised and the flag shall be cleared")
+            {
+                REQUIRE (blockCalls == 0UL);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+                REQUIRE (DMA2->LIFCR == DMA_LIFCR_CTEIF0);
+            }
+        }
+
+        WHEN ("the scan is stopped")
+        {
+            Error_t error = HalAdc_StopScan();
+
+            THEN ("the ADC and the DMA stream shall be stopped")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (Helper_IsBitSet(ADC1->CR2, ADC_CR2_CONT_Pos) == false);
+                REQUIRE (Helper_IsBitSet(ADC1->CR2, ADC_CR2_DMA_Pos) == false);
+                REQUIRE (Helper_IsBitSet(DMA2_Stream0->CR, DMA_SxCR_EN_Pos) == false);
+                REQUIRE (MOCK_LAST_ARG(NVIC_DisableIRQ, 0) == DMA2_Stream0_IRQn);
+
+                AND_THEN ("single conversions shall be possible again")
+                {
+                    REQUIRE (Helper_IsBitSet(ADC1->CR1, ADC_CR1_SCAN_Pos) == false);
+                    Helper_ConfigureChannel(ADC_CHANNEL_5, ADC_RES_12_BIT);
+                    REQUIRE (HalAdc_StartConversion(ADC_CHANNEL_5) == ERROR_OK);
+                    REQUIRE (Helper_IsBitSet(ADC1->CR1, ADC_CR1_EOCIE_Pos));
+
+                    AND_THEN ("stopping again shall fail")
+                    {
+                        REQUIRE (HalAdc_StopScan() == ERROR_INVALID_ACTION);
+                    }
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------
+// HalAdc_ReleaseBlock
+//------------------------------------
+
+SCENARIO ("ADC scan lends blocks from the pool", "[hal][adc][scan][pool]")
+{
+    GIVEN ("the ADC is initialised")
+    {
+        Helper_InitAdc();
+        Helper_UseRegisterModel();
+
+        WHEN ("a scan is started without a buffer")
+        {
+            AdcScanConfig_t config = Helper_PoolScanConfig();
+            Error_t error = HalAdc_StartScan(&config);
+
+            THEN ("the DMA stream shall alternate between two pool blocks")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (NO_ASSERT_ERRORS);
+                REQUIRE (isLending);
+                REQUIRE (DMA2_Stream0->M0AR == (uint32_t)(uintptr_t)aBlockPool[0]);
+                REQUIRE (DMA2_Stream0->M1AR == (uint32_t)(uintptr_t)aBlockPool[1]);
+                REQUIRE (DMA2_Stream0->NDTR == 16UL);
+                REQUIRE (Helper_IsBitSet(DMA2_Stream0->CR, DMA_SxCR_DBM_Pos));
+                REQUIRE (Helper_IsBitSet(DMA2_Stream0->CR, DMA_SxCR_TCIE_Pos));
+                REQUIRE (Helper_IsBitSet(DMA2_Stream0->CR, DMA_SxCR_HTIE_Pos) == false);
+                REQUIRE (Helper_IsBitSet(DMA2_Stream0->CR, DMA_SxCR_EN_Pos));
+
+                AND_THEN ("the other blocks shall stay in the pool")
+                {
+                    REQUIRE (aBlockStates[0] == BLOCK_DMA);
+                    REQUIRE (aBlockStates[1] == BLOCK_DMA);
+                    REQUIRE (aBlockStates[2] == BLOCK_FREE);
+                    REQUIRE (aBlockStates[3] == BLOCK_FREE);
+                }
+            }
+        }
+    }
+
+    GIVEN ("a scan into the pool is running")
+    {
+        Helper_InitAdc();
+        Helper_UseRegisterModel();
+        AdcScanConfig_t config = Helper_PoolScanConfig();
+        REQUIRE (HalAdc_StartScan(&config) == ERROR_OK);
+
+        WHEN ("the first block completes and the stream switches to the second one")
+        {
+            SET_BIT_RegisterModel(&DMA2_Stream0->CR, DMA_SxCR_CT_Pos);
+            DMA2->LISR = DMA_LISR_TCIF0;
+            DMA2_Stream0_IRQHandler();
+
+            THEN ("the first block shall be lent to the callback and replaced with a free block")
+            {
+                REQUIRE (blockCalls == 1UL);
+                REQUIRE (apBlocks[0] == aBlockPool[0]);
+                REQUIRE (aBlockLengths[0] == 16UL);
+                REQUIRE (aBlockStates[0] == BLOCK_LENT);
+                REQUIRE (aBlockStates[2] == BLOCK_DMA);
+                REQUIRE (DMA2_Stream0->M0AR == (uint32_t)(uintptr_t)aBlockPool[2]);
+                REQUIRE (DMA2_Stream0->M1AR == (uint32_t)(uintptr_t)aBlockPool[1]);
+                REQUIRE (DMA2->LIFCR == DMA_LIFCR_CTCIF0);
+            }
+
+            AND_WHEN ("the block is released")
+            {
+                Error_t error = HalAdc_ReleaseBlock(apBlocks[0]);
+
+                THEN ("the block shall be returned to the pool")
+                {
+                    REQUIRE (error == ERROR_OK);
+                    REQUIRE (NO_ASSERT_ERRORS);
+                    REQUIRE (aBlockStates[0] == BLOCK_FREE);
+                }
+            }
+
+            AND_WHEN ("the scan is stopped before the block is released")
+            {
+                REQUIRE (HalAdc_StopScan() == ERROR_OK);
+
+                THEN ("only the blocks of the DMA stream shall be returned to the pool")
+                {
+                    REQUIRE (isLending == false);
+                    REQUIRE (aBlockStates[0] == BLOCK_LENT);
+                    REQUIRE (aBlockStates[1] == BLOCK_FREE);
+                    REQUIRE (aBlockStates[2] == BLOCK_FREE);
+
+                    AND_THEN ("the block shall still be released")
+                    {
+                        REQUIRE (HalAdc_ReleaseBlock(apBlocks[0]) == ERROR_OK);
+                        REQUIRE (aBlockStates[0] == BLOCK_FREE);
+                    }
+                }
+            }
+        }
+
+        WHEN ("the second block completes and the stream switches back to the first one")
+        {
+            DMA2->LISR = DMA_LISR_TCIF0;
+            DMA2_Stream0_IRQHandler();
+
+            THEN ("the second block shall be lent and replaced with a free block")
+            {
+                REQUIRE (blockCalls == 1UL);
+                REQUIRE (apBlocks[0] == aBlockPool[1]);
+                REQUIRE (aBlockStates[1] == BLOCK_LENT);
+                REQUIRE (DMA2_Stream0->M0AR == (uint32_t)(uintptr_t)aBlockPool[0]);
+                REQUIRE (DMA2_Stream0->M1AR == (uint32_t)(uintptr_t)aBlockPool[2]);
+            }
+        }
+
+        WHEN ("only the half transfer flag is set")
+        {
+            DMA2->LISR = DMA_LISR_HTIF0;
+            DMA2_Stream0_IRQHandler();
+
+            THEN ("no block shall be passed to the callback")
+            {
+                REQUIRE (blockCalls == 0UL);
+                REQUIRE (DMA2->LIFCR == DMA_LIFCR_CHTIF0);
+            }
+        }
+
+        WHEN ("the consumer keeps the lent blocks until the pool is empty")
+        {
+            SET_BIT_RegisterModel(&DMA2_Stream0->CR, DMA_SxCR_CT_Pos);
+            DMA2->LISR = DMA_LISR_TCIF0;
+            DMA2_Stream0_IRQHandler();
+            CLEAR_BIT_RegisterModel(&DMA2_Stream0->CR, DMA_SxCR_CT_Pos);
+            DMA2_Stream0_IRQHandler();
+            SET_BIT_RegisterModel(&DMA2_Stream0->CR, DMA_SxCR_CT_Pos);
+            DMA2_Stream0_IRQHandler();
+
+            THEN ("the next block shall be dropped and filled again")
+            {
+                REQUIRE (blockCalls == 2UL);
+                REQUIRE (apBlocks[0] == aBlockPool[0]);
+                REQUIRE (apBlocks[1] == aBlockPool[1]);
+                REQUIRE (HalAdc_GetDroppedBlocks() == 1UL);
+                REQUIRE (DMA2_Stream0->M0AR == (uint32_t)(uintptr_t)aBlockPool[2]);
+                REQUIRE (aBlockStates[2] == BLOCK_DMA);
+                REQUIRE (aBlockStates[3] == BLOCK_DMA);
+
+                AND_WHEN ("a block is released")
+                {
+                    REQUIRE (HalAdc_ReleaseBlock(apBlocks[1]) == ERROR_OK);
+                    DMA2_Stream0_IRQHandler();
+
+                    THEN ("the next block shall be lent again")
+                    {
+                        REQUIRE (blockCalls == 3UL);
+                        REQUIRE (apBlocks[2] == aBlockPool[2]);
+                        REQUIRE (DMA2_Stream0->M0AR == (uint32_t)(uintptr_t)aBlockPool[1]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("ADC pool use fails", "[hal][adc][scan][pool][error_handling]")
+{
+    GIVEN ("the ADC is initialised")
+    {
+        Helper_InitAdc();
+        Helper_UseRegisterModel();
+        AdcScanConfig_t config = Helper_PoolScanConfig();
+
+        WHEN ("a scan into the pool is started with blocks longer than the pool blocks")
+        {
+            config.channelCount = 1U;
+            config.bufferLength = (2UL * ADC_POOL_BLOCK_LENGTH) + 2UL;
+            Error_t error = HalAdc_StartScan(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+                REQUIRE (isScanning == false);
+            }
+        }
+
+        WHEN ("a scan into the pool is started while the consumer holds three blocks")
+        {
+            aBlockStates[0] = BLOCK_LENT;
+            aBlockStates[1] = BLOCK_LENT;
+            aBlockStates[3] = BLOCK_LENT;
+            Error_t error = HalAdc_StartScan(&config);
+
+            THEN ("the scan shall not be started")
+            {
+                REQUIRE (error == ERROR_RESOURCE_NOT_AVAILABLE);
+                REQUIRE (NO_ASSERT_ERRORS);
+                REQUIRE (isScanning == false);
+                REQUIRE (aBlockStates[2] == BLOCK_FREE);
+            }
+        }
+
+        WHEN ("a block that is not lent is released")
+        {
+            Error_t error = HalAdc_ReleaseBlock(aBlockPool[2]);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+
+        WHEN ("a block outside the pool is released")
+        {
+            Error_t error = HalAdc_ReleaseBlock(aScanBuffer);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+    }
+}
+
+//------------------------------------
+// HalAdc_EnableWatchdog
+//------------------------------------
+
+SCENARIO ("ADC watchdog is enabled", "[hal][adc][watchdog]")
+{
+    GIVEN ("a scan is running")
+    {
+        Helper_InitAdc();
+        Helper_UseRegisterModel();
+        AdcScanConfig_t scanConfig = Helper_ScanConfig();
+        REQUIRE (HalAdc_StartScan(&scanConfig) == ERROR_OK);
+        ADC1->SR = ADC_SR_AWD | ADC_SR_EOC;
+
+        WHEN ("the watchdog is enabled on channel 12")
+        {
+            AdcWatchdogConfig_t config = Helper_WatchdogConfig();
+            Error_t error = HalAdc_EnableWatchdog(&config);
+
+            THEN ("no errors shall occur")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (NO_ASSERT_ERRORS);
+
+                AND_THEN ("the window shall be set")
+                {
+                    REQUIRE (ADC1->LTR == 0x400UL);
+                    REQUIRE (ADC1->HTR == 0xC00UL);
+
+                    AND_THEN ("the watchdog shall guard the channel with an interrupt")
+                    {
+                        REQUIRE (((ADC1->CR1 & ADC_CR1_AWDCH_Msk) >> ADC_CR1_AWDCH_Pos) == ADC_CHANNEL_12);
+                        REQUIRE (Helper_IsBitSet(ADC1->CR1, ADC_CR1_AWDSGL_Pos));
+                        REQUIRE (Helper_IsBitSet(ADC1->CR1, ADC_CR1_AWDEN_Pos));
+                        REQUIRE (Helper_IsBitSet(ADC1->CR1, ADC_CR1_AWDIE_Pos));
+                        REQUIRE (MOCK_LAST_ARG(NVIC_EnableIRQ, 0) == ADC_IRQn);
+
+                        AND_THEN ("an old watchdog event shall be cleared without clearing the other flags")
+                        {
+                            REQUIRE (Helper_IsBitSet(ADC1->SR, ADC_SR_AWD_Pos) == false);
+                            REQUIRE (Helper_IsBitSet(ADC1->SR, ADC_SR_EOC_Pos));
+
+                            AND_THEN ("the scan shall not be interrupted per conversion")
+                            {
+                                REQUIRE (Helper_IsBitSet(ADC1->CR1, ADC_CR1_EOCIE_Pos) == false);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("ADC watchdog enable fails", "[hal][adc][watchdog][error_handling]")
+{
+    GIVEN ("a valid watchdog configuration")
+    {
+        Helper_InitAdc();
+        AdcWatchdogConfig_t config = Helper_WatchdogConfig();
+
+        WHEN ("the watchdog is enabled with a null configuration")
+        {
+            Error_t error = HalAdc_EnableWatchdog(NULL);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+
+        WHEN ("the watchdog is enabled on an invalid channel")
+        {
+            config.channel = ADC_CHANNEL_COUNT;
+            Error_t error = HalAdc_EnableWatchdog(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+
+        WHEN ("the watchdog is enabled with the thresholds in the wrong order")
+        {
+            config.lowThreshold = 0xC01U;
+            Error_t error = HalAdc_EnableWatchdog(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+
+        WHEN ("the watchdog is enabled with a too high threshold")
+        {
+            config.highThreshold = ADC_WATCHDOG_MAX_THRESHOLD + 1U;
+            Error_t error = HalAdc_EnableWatchdog(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+
+        WHEN ("the watchdog is enabled without a callback")
+        {
+            config.Callback = NULL;
+            Error_t error = HalAdc_EnableWatchdog(&config);
+
+            THEN ("assert error shall occur and the watchdog shall not be armed")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+                REQUIRE (isWatchdogArmed == false);
+            }
+        }
+    }
+}
+
+SCENARIO ("ADC watchdog is triggered", "[hal][adc][watchdog]")
+{
+    GIVEN ("the watchdog is armed")
+    {
+        Helper_InitAdc();
+        Helper_UseRegisterModel();
+        AdcWatchdogConfig_t config = Helper_WatchdogConfig();
+        REQUIRE (HalAdc_EnableWatchdog(&config) == ERROR_OK);
+
+        WHEN ("a result outside the window is converted")
+        {
+            dataRegister = 0xC01UL;
+            ADC1->SR = ADC_SR_AWD;
+            ADC_IRQHandler();
+
+            THEN ("the result shall be passed to the callback")
+            {
+                REQUIRE (callbackCalls == 1UL);
+                REQUIRE (callbackResult == 0xC01U);
+
+                AND_THEN ("the watchdog shall be disarmed")
+                {
+                    REQUIRE (Helper_IsBitSet(ADC1->SR, ADC_SR_AWD_Pos) == false);
+                    REQUIRE (Helper_IsBitSet(ADC1->CR1, ADC_CR1_AWDIE_Pos) == false);
+                    REQUIRE (isWatchdogArmed == false);
+
+                    AND_WHEN ("the next result outside the window is converted")
+                    {
+                        ADC1->SR = ADC_SR_AWD;
+                        ADC_IRQHandler();
+
+                        THEN ("the callback shall not be called until the watchdog is armed again")
+                        {
+                            REQUIRE (callbackCalls == 1UL);
+                            REQUIRE (HalAdc_EnableWatchdog(&config) == ERROR_OK);
+                            ADC1->SR = ADC_SR_AWD;
+                            ADC_IRQHandler();
+                            REQUIRE (callbackCalls == 2UL);
+                        }
+                    }
+                }
+            }
+        }
+
+        WHEN ("the watchdog is disabled")
+        {
+            HalAdc_DisableWatchdog();
+
+            THEN ("the watchdog and its interrupt shall be disabled")
+            {
+                REQUIRE (Helper_IsBitSet(ADC1->CR1, ADC_CR1_AWDEN_Pos) == false);
+                REQUIRE (Helper_IsBitSet(ADC1->CR1, ADC_CR1_AWDIE_Pos) == false);
+
+                AND_THEN ("a pending event shall not be passed to the callback")
+                {
+                    ADC1->SR = ADC_SR_AWD;
+                    ADC_IRQHandler();
+                    REQUIRE (callbackCalls == 0UL);
+                }
+            }
+        }
+    }
+
+    GIVEN ("a single conversion of the guarded channel is started")
+    {
+        Helper_InitAdc();
+        Helper_UseRegisterModel();
+        AdcWatchdogConfig_t config = Helper_WatchdogConfig();
+        config.Callback = Helper_WatchdogCallback;
+        REQUIRE (HalAdc_EnableWatchdog(&config) == ERROR_OK);
+        Helper_ConfigureChannel(ADC_CHANNEL_12, ADC_RES_12_BIT);
+        REQUIRE (HalAdc_StartConversion(ADC_CHANNEL_12) == ERROR_OK);
+
+        WHEN ("the result is outside the window")
+        {
+            dataRegister = 0x3FFUL;
+            ADC1->SR = ADC_SR_AWD | ADC_SR_EOC;
+            ADC_IRQHandler();
+
+            THEN ("both the conversion callback and the watchdog callback shall get the result")
+            {
+                REQUIRE (callbackCalls == 1UL);
+                REQUIRE (callbackResult == 0x3FFU);
+                REQUIRE (watchdogCalls == 1UL);
+                REQUIRE (isConverting == false);
+            }
+        }
+    }
+}
+
+//------------------------------------
+// HalAdc_StartCapture
+//------------------------------------
+
+SCENARIO ("ADC capture is started", "[hal][adc][capture]")
+{
+    GIVEN ("a capture configuration of channel 3")
+    {
+        Helper_InitAdc();
+        Helper_UseRegisterModel();
+        AdcCaptureConfig_t config = Helper_CaptureConfig();
+
+        WHEN ("the capture is started")
+        {
+            Error_t error = HalAdc_StartCapture(&config);
+
+            THEN ("no errors shall occur")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (NO_ASSERT_ERRORS);
+                REQUIRE (isCapturing);
+
+                AND_THEN ("all three ADCs shall be clocked")
+                {
+                    REQUIRE (Helper_IsBitSet(RCC->APB2ENR, RCC_APB2ENR_ADC1EN_Pos));
+                    REQUIRE (Helper_IsBitSet(RCC->APB2ENR, RCC_APB2ENR_ADC2EN_Pos));
+                    REQUIRE (Helper_IsBitSet(RCC->APB2ENR, RCC_APB2ENR_ADC3EN_Pos));
+                }
+
+                AND_THEN ("the DMA shall move two results per word from the common data register into the buffer")
+                {
+                    REQUIRE (DMA2_Stream0->PAR == (uint32_t)(uintptr_t)&ADC123_COMMON->CDR);
+                    REQUIRE (DMA2_Stream0->M0AR == (uint32_t)(uintptr_t)aCaptureBuffer);
+                    REQUIRE (DMA2_Stream0->NDTR == 16UL);
+                    REQUIRE ((DMA2_Stream0->CR & DMA_SxCR_MSIZE_Msk) == (2UL << DMA_SxCR_MSIZE_Pos));
+                    REQUIRE ((DMA2_Stream0->CR & DMA_SxCR_PSIZE_Msk) == (2UL << DMA_SxCR_PSIZE_Pos));
+                    REQUIRE (Helper_IsBitSet(DMA2_Stream0->CR, DMA_SxCR_CIRC_Pos));
+                    REQUIRE (Helper_IsBitSet(DMA2_Stream0->CR, DMA_SxCR_HTIE_Pos));
+                    REQUIRE (Helper_IsBitSet(DMA2_Stream0->CR, DMA_SxCR_TCIE_Pos));
+                    REQUIRE (Helper_IsBitSet(DMA2_Stream0->CR, DMA_SxCR_EN_Pos));
+                    REQUIRE (MOCK_LAST_ARG(NVIC_EnableIRQ, 0) == DMA2_Stream0_IRQn);
+                }
+
+                AND_THEN ("each ADC shall convert the channel continuously with the shortest sample time and guard it")
+                {
+                    for (ADC_TypeDef* pAdc : {ADC1, ADC2, ADC3})
+                    {
+                        REQUIRE ((pAdc->SQR3 & ADC_SQR3_SQ1_Msk) == (uint32_t)ADC_CHANNEL_3);
+                        REQUIRE ((pAdc->SQR1 & ADC_SQR1_L_Msk) == 0UL);
+                        REQUIRE ((pAdc->SMPR2 & ADC_SMPR2_SMP3_Msk) == 0UL);
+                        REQUIRE ((pAdc->CR1 & ADC_CR1_RES_Msk) == ((uint32_t)ADC_RES_8_BIT << ADC_CR1_RES_Pos));
+                        REQUIRE (Helper_IsBitSet(pAdc->CR1, ADC_CR1_EOCIE_Pos) == false);
+                        REQUIRE (Helper_IsBitSet(pAdc->CR1, ADC_CR1_SCAN_Pos) == false);
+                        REQUIRE (Helper_IsBitSet(pAdc->CR2, ADC_CR2_CONT_Pos));
+                        REQUIRE (Helper_IsBitSet(pAdc->CR2, ADC_CR2_ADON_Pos));
+                        REQUIRE (pAdc->LTR == 0x10UL);
+                        REQUIRE (pAdc->HTR == 0xE0UL);
+                        REQUIRE ((pAdc->CR1 & ADC_CR1_AWDCH_Msk) == (uint32_t)ADC_CHANNEL_3);
+                        REQUIRE (Helper_IsBitSet(pAdc->CR1, ADC_CR1_AWDSGL_Pos));
+                        REQUIRE (Helper_IsBitSet(pAdc->CR1, ADC_CR1_AWDEN_Pos));
+                        REQUIRE (Helper_IsBitSet(pAdc->CR1, ADC_CR1_AWDIE_Pos));
+                    }
+                }
+
+                AND_THEN ("the ADCs shall run in the triple interleaved mode with DMA mode 2")
+                {
+                    REQUIRE ((ADC123_COMMON->CCR & ADC_CCR_MULTI_Msk) == (0x17UL << ADC_CCR_MULTI_Pos));
+                    REQUIRE ((ADC123_COMMON->CCR & ADC_CCR_DELAY_Msk) == 0UL);
+                    REQUIRE ((ADC123_COMMON->CCR & ADC_CCR_DMA_Msk) == (2UL << ADC_CCR_DMA_Pos));
+                    REQUIRE (Helper_IsBitSet(ADC123_COMMON->CCR, ADC_CCR_DDS_Pos));
+
+                    AND_THEN ("the master ADC shall be started by software")
+                    {
+                        REQUIRE (Helper_IsBitSet(ADC1->CR2, ADC_CR2_SWSTART_Pos));
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("ADC capture start fails", "[hal][adc][capture][error_handling]")
+{
+    GIVEN ("a valid capture configuration")
+    {
+        Helper_InitAdc();
+        Helper_UseRegisterModel();
+        AdcCaptureConfig_t config = Helper_CaptureConfig();
+
+        WHEN ("a capture is started with a null configuration")
+        {
+            Error_t error = HalAdc_StartCapture(NULL);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+
+        WHEN ("a capture is started on a channel that is on a different pin on ADC3")
+        {
+            config.channel = ADC_CHANNEL_5;
+            Error_t error = HalAdc_StartCapture(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+            }
+        }
+
+        WHEN ("a capture is started with a buffer that is not 32-bit aligned")
+        {
+            config.pBuffer = &aCaptureBuffer[1];
+            config.bufferLength = 28UL;
+            Error_t error = HalAdc_StartCapture(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+            }
+        }
+
+        WHEN ("a capture is started with a buffer that does not split into two halves of whole DMA transfers")
+        {
+            config.bufferLength = 30UL;
+            Error_t error = HalAdc_StartCapture(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+            }
+        }
+
+        WHEN ("a capture is started with more samples after the trigger than in half of the buffer")
+        {
+            config.postTriggerLength = 17UL;
+            Error_t error = HalAdc_StartCapture(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+            }
+        }
+
+        WHEN ("a capture is started with no samples after the trigger")
+        {
+            config.postTriggerLength = 0UL;
+            Error_t error = HalAdc_StartCapture(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+            }
+        }
+
+        WHEN ("a capture is started with the thresholds in the wrong order")
+        {
+            config.lowThreshold = 0xE1U;
+            Error_t error = HalAdc_StartCapture(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+            }
+        }
+
+        WHEN ("a capture is started without a callback")
+        {
+            config.Callback = NULL;
+            Error_t error = HalAdc_StartCapture(&config);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (isCapturing == false);
+            }
+        }
+
+        WHEN ("a capture is started while the watchdog is armed")
+        {
+            AdcWatchdogConfig_t watchdogConfig = Helper_WatchdogConfig();
+            REQUIRE (HalAdc_EnableWatchdog(&watchdogConfig) == ERROR_OK);
+            Error_t error = HalAdc_StartCapture(&config);
+
+            THEN ("the capture shall not be started")
+            {
+                REQUIRE (error == ERROR_RESOURCE_NOT_AVAILABLE);
+                REQUIRE (isCapturing == false);
+                REQUIRE (NO_ASSERT_ERRORS);
+            }
+        }
+
+        WHEN ("a capture is started while a scan is running")
+        {
+            AdcScanConfig_t scanConfig = Helper_ScanConfig();
+            REQUIRE (HalAdc_StartScan(&scanConfig) == ERROR_OK);
+            Error_t error = HalAdc_StartCapture(&config);
+
+            THEN ("the capture shall not be started")
+            {
+                REQUIRE (error == ERROR_RESOURCE_NOT_AVAILABLE);
+                REQUIRE (isCapturing == false);
+            }
+        }
+    }
+
+    GIVEN ("a capture is running")
+    {
+        Helper_InitAdc();
+        Helper_UseRegisterModel();
+        AdcCaptureConfig_t config = Helper_CaptureConfig();
+        REQUIRE (HalAdc_StartCapture(&config) == ERROR_OK);
+
+        WHEN ("the ADC is used otherwise")
+        {
+            Helper_ConfigureChannel(ADC_CHANNEL_3, ADC_RES_12_BIT);
+            AdcScanConfig_t scanConfig = Helper_ScanConfig();
+            AdcWatchdogConfig_t watchdogConfig = Helper_WatchdogConfig();
+
+            THEN ("conversions, scans, watchdogs and other captures shall not be started")
+            {
+                REQUIRE (HalAdc_StartConversion(ADC_CHANNEL_3) == ERROR_RESOURCE_NOT_AVAILABLE);
+                REQUIRE (HalAdc_StartScan(&scanConfig) == ERROR_RESOURCE_NOT_AVAILABLE);
+                REQUIRE (HalAdc_EnableWatchdog(&watchdogConfig) == ERROR_RESOURCE_NOT_AVAILABLE);
+                REQUIRE (HalAdc_StartCapture(&config) == ERROR_RESOURCE_NOT_AVAILABLE);
+                REQUIRE (isWatchdogArmed == false);
+            }
+        }
+    }
+}
+
+//------------------------------------
+// HalAdc_TriggerCapture
+//------------------------------------
+
+SCENARIO ("ADC capture is triggered", "[hal][adc][capture]")
+{
+    GIVEN ("a capture of 32 samples with 8 samples after the trigger is running")
+    {
+        Helper_InitAdc();
+        Helper_UseRegisterModel();
+        AdcCaptureConfig_t config = Helper_CaptureConfig();
+        REQUIRE (HalAdc_StartCapture(&config) == ERROR_OK);
+
+        WHEN ("ADC2 sees a result outside the window when the DMA writes sample 6")
+        {
+            DMA2_Stream0->NDTR = 13UL;
+            ADC2->SR = ADC_SR_AWD;
+            ADC_IRQHandler();
+
+            THEN ("the capture shall be triggered and the watchdogs disarmed")
+            {
+                REQUIRE (isCaptureTriggered);
+                REQUIRE (ADC2->SR == ~(uint32_t)ADC_SR_AWD);
+                REQUIRE (DMA2->LIFCR == DMA_LIFCR_CTCIF0);
+                for (ADC_TypeDef* pAdc : {ADC1, ADC2, ADC3})
+                {
+                    REQUIRE (Helper_IsBitSet(pAdc->CR1, ADC_CR1_AWDIE_Pos) == false);
+                }
+
+                AND_WHEN ("the first half of the buffer is filled")
+                {
+                    DMA2_Stream0->NDTR = 7UL;
+                    DMA2->LISR = DMA_LISR_HTIF0;
+                    DMA2_Stream0_IRQHandler();
+
+                    THEN ("the capture shall end and the buffer shall be passed to the callback in place")
+                    {
+                        REQUIRE (captureCalls == 1UL);
+                        REQUIRE (lastCapture.pBuffer == aCaptureBuffer);
+                        REQUIRE (lastCapture.length == 32UL);
+                        REQUIRE (lastCapture.triggerIndex == 6UL);
+                        REQUIRE (lastCapture.firstIndex == 18UL);
+                        REQUIRE (isCapturing == false);
+
+                        AND_THEN ("the ADCs and the DMA shall be stopped and the independent mode restored")
+                        {
+                            REQUIRE (Helper_IsBitSet(DMA2_Stream0->CR, DMA_SxCR_EN_Pos) == false);
+                            REQUIRE (MOCK_LAST_ARG(NVIC_DisableIRQ, 0) == DMA2_Stream0_IRQn);
+                            REQUIRE ((ADC123_COMMON->CCR & ADC_CCR_MULTI_Msk) == 0UL);
+                            REQUIRE ((ADC123_COMMON->CCR & ADC_CCR_DMA_Msk) == 0UL);
+                            REQUIRE (Helper_IsBitSet(ADC123_COMMON->CCR, ADC_CCR_DDS_Pos) == false);
+                            for (ADC_TypeDef* pAdc : {ADC1, ADC2, ADC3})
+                            {
+                                REQUIRE (Helper_IsBitSet(pAdc->CR2, ADC_CR2_CONT_Pos) == false);
+                                REQUIRE (Helper_IsBitSet(pAdc->CR1, ADC_CR1_AWDEN_Pos) == false);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        WHEN ("the capture is triggered by software when the DMA writes sample 12")
+        {
+            DMA2_Stream0->NDTR = 10UL;
+            Error_t error = HalAdc_TriggerCapture();
+
+            THEN ("the capture shall be triggered")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (isCaptureTriggered);
+
+                AND_WHEN ("the first half of the buffer is filled")
+                {
+                    DMA2->LISR = DMA_LISR_HTIF0;
+                    DMA2_Stream0_IRQHandler();
+
+                    THEN ("the capture shall go on since there are too few samples after the trigger")
+                    {
+                        REQUIRE (captureCalls == 0UL);
+                        REQUIRE (isCapturing);
+
+                        AND_WHEN ("the second half of the buffer is filled")
+                        {
+                            DMA2_Stream0->NDTR = 15UL;
+                            DMA2->LISR = DMA_LISR_TCIF0;
+                            DMA2_Stream0_IRQHandler();
+
+                            THEN ("the capture shall end")
+                            {
+                                REQUIRE (captureCalls == 1UL);
+                                REQUIRE (lastCapture.triggerIndex == 12UL);
+                                REQUIRE (lastCapture.firstIndex == 2UL);
+                                REQUIRE (isCapturing == false);
+                            }
+                        }
+                    }
+                }
+
+                AND_WHEN ("the capture is triggered again")
+                {
+                    error = HalAdc_TriggerCapture();
+
+                    THEN ("the trigger shall be refused")
+                    {
+                        REQUIRE (error == ERROR_INVALID_ACTION);
+                        REQUIRE (NO_ASSERT_ERRORS);
+                    }
+                }
+            }
+        }
+
+        WHEN ("the half transfer interrupt occurs before the trigger")
+        {
+            DMA2->LISR = DMA_LISR_HTIF0;
+            DMA2_Stream0_IRQHandler();
+
+            THEN ("the capture shall go on and no scan blocks shall be passed")
+            {
+                REQUIRE (captureCalls == 0UL);
+                REQUIRE (blockCalls == 0UL);
+                REQUIRE (isCapturing);
+            }
+        }
+
+        WHEN ("the transfer error interrupt occurs")
+        {
+            DMA2->LISR = DMA_LISR_TEIF0;
+            DMA2_Stream0_IRQHandler();
+
+            THEN ("an ADC error shall be raised")
+            {
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_ADC_FAILURE));
+            }
+        }
+
+        WHEN ("the capture is stopped")
+        {
+            Error_t error = HalAdc_StopCapture();
+
+            THEN ("the capture shall be aborted without calling the callback")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (captureCalls == 0UL);
+                REQUIRE (isCapturing == false);
+                REQUIRE ((ADC123_COMMON->CCR & ADC_CCR_MULTI_Msk) == 0UL);
+
+                AND_THEN ("stopping or triggering again shall fail")
+                {
+                    REQUIRE (HalAdc_StopCapture() == ERROR_INVALID_ACTION);
+                    REQUIRE (HalAdc_TriggerCapture() == ERROR_INVALID_ACTION);
+                }
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Helper Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+static void Helper_InitAdc(void)
+{
+    FFF_RESET_HISTORY();
+    CMSIS_MOCK_RESET();
+    HAL_MOCK_RESET();
+    SYSTEM_MOCK_RESET();
+    MOCK_SET_CUSTOM_FAKE(REG_READ_MOCK, REG_READ_CustomFake);
+    for (uint32_t i = 0UL; i < ADC_CHANNEL_COUNT; ++i)
+    {
+        aCallbacks[i] = NULL;
+    }
+    isConverting = false;
+    isScanning = false;
+    pTriggerTimer = NULL;
+    isLending = false;
+    for (uint32_t i = 0UL; i < ADC_POOL_BLOCK_COUNT; ++i)
+    {
+        aBlockStates[i] = BLOCK_FREE;
+    }
+    droppedBlocks = 0UL;
+    isWatchdogArmed = false;
+    isCapturing = false;
+    isCaptureTriggered = false;
+    injectedChannelCount = 0UL;
+    isInjectedConverting = false;
+    aInjectedChannels[0] = {ADC_CHANNEL_12, ADC_SAMPLE_TIME_84_CYCLES, Helper_RecordingCallback};
+    aInjectedChannels[1] = {ADC_CHANNEL_3, ADC_SAMPLE_TIME_15_CYCLES, Helper_InjectedCallback};
+    aInjectedChannels[2] = {ADC_CHANNEL_17, ADC_SAMPLE_TIME_480_CYCLES, Helper_InjectedCallback};
+    aInjectedChannels[3] = {ADC_CHANNEL_18, ADC_SAMPLE_TIME_480_CYCLES, Helper_InjectedCallback};
+    injectedCalls = 0UL;
+    maxLatencyCycles = 0UL;
+    captureCalls = 0UL;
+    blockCalls = 0UL;
+    watchdogCalls = 0UL;
+    updateTriggers = 0UL;
+    callbackCalls = 0UL;
+    callbackResult = 0U;
+    dataRegister = 0UL;
+    cycleCounter = 0UL;
+    return;
+}
+
+static void Helper_ConfigureChannel(AdcChannel_t channel, AdcResolution_t resolution)
+{
+    AdcConfig_t config =
+    {
+        .channel = channel,
+        .resolution = resolution,
+        .sampleTime = ADC_SAMPLE_TIME_84_CYCLES,
+        .Callback = Helper_RecordingCallback
+    };
+    HalAdc_SetConfiguration(&config);
+    return;
+}
+
+static void Helper_RecordingCallback(uint16_t result)
+{
+    ++callbackCalls;
+    callbackResult = result;
+    return;
+}
+
+static void Helper_InjectedCallback(uint16_t result)
+{
+    if (injectedCalls < ADC_INJECTED_MAX_CHANNELS)
+    {
+        aInjectedResults[injectedCalls] = result;
+    }
+    ++injectedCalls;
+    return;
+}
+
+static void Helper_RestartingCallback(uint16_t result)
+{
+    ++callbackCalls;
+    callbackResult = result;
+    (void)HalAdc_StartConversion(ADC_CHANNEL_2);
+    return;
+}
+
+static void Helper_BlockCallback(const uint16_t* pSamples, uint32_t sampleCount)
+{
+    if (blockCalls < ARRAY_LENGTH(apBlocks, const uint16_t*))
+    {
+        apBlocks[blockCalls] = pSamples;
+        aBlockLengths[blockCalls] = sampleCount;
+    }
+    ++blockCalls;
+    return;
+}
+
+static void Helper_UseRegisterModel(void)
+{
+    memset(ADC1, 0, sizeof(ADC_TypeDef));
+    memset(ADC2, 0, sizeof(ADC_TypeDef));
+    memset(ADC3, 0, sizeof(ADC_TypeDef));
+    memset(ADC123_COMMON, 0, sizeof(ADC_Common_TypeDef));
+    memset(DMA2, 0, sizeof(DMA_TypeDef));
+    memset(DMA2_Stream0, 0, sizeof(DMA_Stream_TypeDef));
+    memset(RCC, 0, sizeof(RCC_TypeDef));
+    memset(timers, 0, sizeof(timers));
+    MOCK_SET_CUSTOM_FAKE(REG_WRITE_MOCK, REG_WRITE_RegisterModel);
+    MOCK_SET_CUSTOM_FAKE(SET_BIT_MOCK, SET_BIT_RegisterModel);
+    MOCK_SET_CUSTOM_FAKE(CLEAR_BIT_MOCK, CLEAR_BIT_RegisterModel);
+    MOCK_SET_CUSTOM_FAKE(GET_BIT_MOCK, GET_BIT_RegisterModel);
+    MOCK_SET_CUSTOM_FAKE(SET_BITFIELD_MOCK, SET_BITFIELD_RegisterModel);
+    MOCK_SET_CUSTOM_FAKE(GET_BITFIELD_MOCK, GET_BITFIELD_RegisterModel);
+    return;
+}
+
+static bool Helper_IsBitSet(uint32_t value, uint32_t bit)
+{
+    return ((value & BIT_(bit)) != 0UL);
+}
+
+static AdcScanConfig_t Helper_ScanConfig(void)
+{
+    AdcScanConfig_t config =
+    {
+        .pChannels = aScanChannels,
+        .channelCount = ADC_SCAN_MAX_CHANNELS,
+        .resolution = ADC_RES_10_BIT,
+        .sampleTime = ADC_SAMPLE_TIME_84_CYCLES,
+        .pBuffer = aScanBuffer,
+        .bufferLength = ARRAY_LENGTH(aScanBuffer, uint16_t),
+        .Callback = Helper_BlockCallback,
+        .trigger = ADC_TRIGGER_CONTINUOUS,
+        .scanRate = 0UL
+    };
+    return config;
+}
+
+static AdcScanConfig_t Helper_PoolScanConfig(void)
+{
+    AdcScanConfig_t config = Helper_ScanConfig();
+    config.pBuffer = NULL;
+    return config;
+}
+
+static AdcWatchdogConfig_t Helper_WatchdogConfig(void)
+{
+    AdcWatchdogConfig_t config =
+    {
+        .channel = ADC_CHANNEL_12,
+        .lowThreshold = 0x400U,
+        .highThreshold = 0xC00U,
+        .Callback = Helper_RecordingCallback
+    };
+    return config;
+}
+
+static void Helper_WatchdogCallback(uint16_t result)
+{
+    (void)result;
+    ++watchdogCalls;
+    return;
+}
+
+static AdcCaptureConfig_t Helper_CaptureConfig(void)
+{
+    AdcCaptureConfig_t config =
+    {
+        .channel = ADC_CHANNEL_3,
+        .resolution = ADC_RES_8_BIT,
+        .pBuffer = aCaptureBuffer,
+        .bufferLength = ARRAY_LENGTH(aCaptureBuffer, uint16_t),
+        .postTriggerLength = 8UL,
+        .lowThreshold = 0x10U,
+        .highThreshold = 0xE0U,
+        .Callback = Helper_CaptureCallback
+    };
+    return config;
+}
+
+static void Helper_CaptureCallback(const AdcCapture_t* pCapture)
+{
+    ++captureCalls;
+    lastCapture = *pCapture;
+    return;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Custom Fake Definitions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+static uint32_t REG_READ_CustomFake(uint32_t* pRegister)
+{
+    uint32_t value = 0UL;
+    if (pRegister == &ADC1->DR)
+    {
+        value = dataRegister;
+    }
+    else if (pRegister == &DWT->CYCCNT)
+    {
+        value = cycleCounter;
+    }
+    else if ((pRegister == &DMA2_Stream0->NDTR) || ((pRegister >= &ADC1->JDR1) && (pRegister <= &ADC1->JDR4)))
+    {
+        value = *pRegister;
+    }
+    return value;
+}
+
+static void REG_WRITE_RegisterModel(uint32_t* pRegister, uint32_t value)
+{
+    *pRegister = value;
+    return;
+}
+
+static void SET_BIT_RegisterModel(uint32_t* pRegister, uint32_t bit)
+{
+    *pRegister |= BIT_(bit);
+    return;
+}
+
+static void CLEAR_BIT_RegisterModel(uint32_t* pRegister, uint32_t bit)
+{
+    *pRegister &= ~BIT_(bit);
+    return;
+}
+
+static bool GET_BIT_RegisterModel(uint32_t* pRegister, uint32_t bit)
+{
+    return Helper_IsBitSet(*pRegister, bit);
+}
+
+static void SET_BITFIELD_RegisterModel(uint32_t* pRegister, uint32_t position, uint32_t mask, uint32_t pattern)
+{
+    *pRegister = (*pRegister & ~(mask << position)) | ((pattern & mask) << position);
+    return;
+}
+
+static uint32_t GET_BITFIELD_RegisterModel(uint32_t* pRegister, uint32_t position, uint32_t mask)
+{
+    return (*pRegister >> position) & mask;
+}
+
+static void REG_WRITE_UpdateTrigger(uint32_t* pRegister, uint32_t value)
+{
+    if ((pRegister == &TIM3->EGR) && ((value & TIM_EGR_UG) != 0UL) && ((TIM3->CR2 & TIM_CR2_MMS_Msk) != 0UL) &&
+        ((ADC1->CR2 & ADC_CR2_EXTEN_Msk) != 0UL))
+    {
+        ++updateTriggers;
+    }
+    *pRegister = value;
+    return;
+}
@@ -72,6 +72,12 @@ static GPIO_TypeDef* Helper_GetCorrespondingGpioStruct(GpioPort_t port);
 /// @return A corresponding clock enable bit.
 static uint32_t Helper_GetCorrespondingClockEnableBit(GpioPort_t port);
 
+/// @brief A pin map of two pins of port A and one pin of port C for the port configuration tests.
+#define TEST_PIN_MAP(ENTRY_, port_) \
+    ENTRY_(port_, portC, 13U, input, false, low, pullDown, af0) \
+    ENTRY_(port_, portA, 0U, output, true, high, pullUp, af0) \
+    ENTRY_(port_, portA, 9U, alternate, false, veryHigh, floating, af7)
+
 //-----------------------------------------------------------------------------------------------------------------------------
 // Test Cases
 //-----------------------------------------------------------------------------------------------------------------------------
@@ -340,6 +346,331 @@ SCENARIO ("GPIO configuration is set erroneously", "[hal][gpio][error_handling]"
     }
 }
 
+//------------------------------------
+// HalGpio_SetConfigurationArray
+//------------------------------------
+
+SCENARIO ("GPIO configurations are set as an array", "[hal][gpio]")
+{
+    INIT_MOCKS();
+    SYSTEM_MOCK_RESET();
+    HAL_MOCK_RESET();
+
+    GIVEN ("configurations of two pins of port A and one pin of port C, and registers full of ones")
+    {
+        const GpioConfig_t aGpios[] =
+        {
+            {.pin = {portC, 13U}, .mode = input, .isOpenDrain = false, .speed = low, .pull = pullDown,
+             .alternateFunction = af0},
+            {.pin = {portA, 0U}, .mode = output, .isOpenDrain = true, .speed = high, .pull = pullUp, .alternateFunction = af0},
+            {.pin = {portA, 9U}, .mode = alternate, .isOpenDrain = false, .speed = veryHigh, .pull = floating,
+             .alternateFunction = af7}
+        };
+        MOCK_SET_RETURN_VALUE(REG_READ_MOCK, 0xFFFFFFFFUL);
+
+        WHEN ("the configurations are set")
+        {
+            HalGpio_SetConfigurationArray(aGpios, ARRAY_LENGTH(aGpios, GpioConfig_t));
+
+            THEN ("no errors shall occur")
+            {
+                REQUIRE (NO_ASSERT_ERRORS);
+
+                AND_THEN ("the clock of each port shall be enabled once")
+                {
+                    REQUIRE (MOCK_CALLS(SET_BIT_MOCK) == 2U);
+                    REQUIRE (MOCK_ARG_HISTORY(SET_BIT_MOCK, 1, 0) == RCC_AHB1ENR_GPIOAEN_Pos);
+                    REQUIRE (MOCK_ARG_HISTORY(SET_BIT_MOCK, 1, 1) == RCC_AHB1ENR_GPIOCEN_Pos);
+                }
+
+                AND_THEN ("each register of a port shall be read and written once for all its pins")
+                {
+                    REQUIRE (MOCK_CALLS(REG_READ_MOCK) == 11U);
+                    REQUIRE (MOCK_CALLS(REG_WRITE_MOCK) == 11U);
+                    REQUIRE (MOCK_CALLS(SET_BITFIELD_MOCK) == 0U);
+                    REQUIRE (MOCK_CALLS(CLEAR_BIT_MOCK) == 0U);
+                }
+
+                AND_THEN ("the fields of port A shall be written and the other fields shall be kept")
+                {
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 0, 0) == &GPIOA->MODER);
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 1, 0) == 0xFFFBFFFDUL);
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 0, 1) == &GPIOA->OTYPER);
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 1, 1) == 0xFFFFFDFFUL);
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 0, 2) == &GPIOA->OSPEEDR);
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 1, 2) == 0xFFFFFFFEUL);
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 0, 3) == &GPIOA->PUPDR);
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 1, 3) == 0xFFF3FFFDUL);
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 0, 4) == &GPIOA->AFR[0]);
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 1, 4) == 0xFFFFFFF0UL);
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 0, 5) == &GPIOA->AFR[1]);
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 1, 5) == 0xFFFFFF7FUL);
+                }
+
+                AND_THEN ("the fields of port C shall be written without the unused AFRL")
+                {
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 0, 6) == &GPIOC->MODER);
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 1, 6) == 0xF3FFFFFFUL);
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 0, 7) == &GPIOC->OTYPER);
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 1, 7) == 0xFFFFDFFFUL);
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 0, 8) == &GPIOC->OSPEEDR);
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 0, 9) == &GPIOC->PUPDR);
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 1, 9) == 0xFBFFFFFFUL);
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 0, 10) == &GPIOC->AFR[1]);
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 1, 10) == 0xFF0FFFFFUL);
+                }
+            }
+        }
+    }
+
+    GIVEN ("two configurations of the same pin")
+    {
+        const GpioConfig_t aGpios[] =
+        {
+            {.pin = {portB, 3U}, .mode = output, .isOpenDrain = true, .speed = high, .pull = pullUp, .alternateFunction = af5},
+            {.pin = {portB, 3U}, .mode = analog, .isOpenDrain = false, .speed = low, .pull = floating, .alternateFunction = af0}
+        };
+
+        WHEN ("the configurations are set")
+        {
+            HalGpio_SetConfigurationArray(aGpios, ARRAY_LENGTH(aGpios, GpioConfig_t));
+
+            THEN ("the later configuration shall be written")
+            {
+                REQUIRE (NO_ASSERT_ERRORS);
+                REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 1, 0) == (0x3UL << 6));
+                REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 1, 1) == 0UL);
+                REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 1, 4) == 0UL);
+            }
+        }
+    }
+
+    GIVEN ("an empty array")
+    {
+        const GpioConfig_t gpio = {.pin = {portA, 0U}};
+
+        WHEN ("no configurations are set")
+        {
+            HalGpio_SetConfigurationArray(&gpio, 0UL);
+
+            THEN ("no registers shall be accessed")
+            {
+                REQUIRE (NO_ASSERT_ERRORS);
+                REQUIRE (MOCK_CALLS(SET_BIT_MOCK) == 0U);
+                REQUIRE (MOCK_CALLS(REG_WRITE_MOCK) == 0U);
+            }
+        }
+    }
+}
+
+SCENARIO ("GPIO configurations are set as an array erroneously", "[hal][gpio][error_handling]")
+{
+    INIT_MOCKS();
+    SYSTEM_MOCK_RESET();
+    HAL_MOCK_RESET();
+
+    GIVEN ("an array with an invalid pin after a valid one")
+    {
+        GpioConfig_t aGpios[2] = {};
+        Helper_RandomisePin(&aGpios[0].pin);
+        Helper_RandomisePin(&aGpios[1].pin);
+        aGpios[1].pin.number = 16U;
+
+        WHEN ("the configurations are set")
+        {
+            HalGpio_SetConfigurationArray(aGpios, 2UL);
+
+            THEN ("assert error shall occur and no pin shall be configured")
+            {
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_GPIO_FAILURE));
+                REQUIRE (MOCK_CALLS(SET_BIT_MOCK) == 0U);
+                REQUIRE (MOCK_CALLS(REG_WRITE_MOCK) == 0U);
+            }
+        }
+    }
+
+    GIVEN ("an array is not created")
+    {
+        WHEN ("the configurations are set from null array")
+        {
+            HalGpio_SetConfigurationArray(NULL, 1UL);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_GPIO_FAILURE));
+            }
+        }
+    }
+}
+
+//------------------------------------
+// HalGpio_SetPortConfigurations
+//------------------------------------
+
+SCENARIO ("GPIO port configurations are created at compile time", "[hal][gpio]")
+{
+    GIVEN ("a pin map of two pins of port A and one pin of port C")
+    {
+        WHEN ("the configuration of port A is created")
+        {
+            static constexpr GpioPortConfig_t config = GPIO_PORT_CONFIG(TEST_PIN_MAP, portA);
+
+            THEN ("the fields of both pins of port A shall be collected")
+            {
+                STATIC_REQUIRE (config.port == portA);
+                STATIC_REQUIRE (config.modeMask == 0x000C0003UL);
+                STATIC_REQUIRE (config.mode == 0x00080001UL);
+                STATIC_REQUIRE (config.openDrainMask == 0x00000201UL);
+                STATIC_REQUIRE (config.openDrain == 0x00000001UL);
+                STATIC_REQUIRE (config.speedMask == 0x000C0003UL);
+                STATIC_REQUIRE (config.speed == 0x000C0002UL);
+                STATIC_REQUIRE (config.pullMask == 0x000C0003UL);
+                STATIC_REQUIRE (config.pull == 0x00000001UL);
+                STATIC_REQUIRE (config.aAfMasks[0] == 0x0000000FUL);
+                STATIC_REQUIRE (config.aAfs[0] == 0UL);
+                STATIC_REQUIRE (config.aAfMasks[1] == 0x000000F0UL);
+                STATIC_REQUIRE (config.aAfs[1] == 0x00000070UL);
+            }
+        }
+
+        WHEN ("the configuration of port C is created")
+        {
+            static constexpr GpioPortConfig_t config = GPIO_PORT_CONFIG(TEST_PIN_MAP, portC);
+
+            THEN ("only the fields of the pin of port C shall be collected")
+            {
+                STATIC_REQUIRE (config.modeMask == 0x0C000000UL);
+                STATIC_REQUIRE (config.mode == 0UL);
+                STATIC_REQUIRE (config.openDrainMask == 0x00002000UL);
+                STATIC_REQUIRE (config.pull == 0x08000000UL);
+                STATIC_REQUIRE (config.aAfMasks[0] == 0UL);
+                STATIC_REQUIRE (config.aAfMasks[1] == 0x00F00000UL);
+            }
+        }
+
+        WHEN ("the configuration of a port without pins is created")
+        {
+            static constexpr GpioPortConfig_t config = GPIO_PORT_CONFIG(TEST_PIN_MAP, portB);
+
+            THEN ("no fields shall be selected")
+            {
+                STATIC_REQUIRE (config.modeMask == 0UL);
+                STATIC_REQUIRE (config.openDrainMask == 0UL);
+                STATIC_REQUIRE (config.aAfMasks[0] == 0UL);
+                STATIC_REQUIRE (config.aAfMasks[1] == 0UL);
+            }
+        }
+    }
+}
+
+SCENARIO ("GPIO port configurations are set", "[hal][gpio]")
+{
+    INIT_MOCKS();
+    SYSTEM_MOCK_RESET();
+    HAL_MOCK_RESET();
+
+    GIVEN ("the port configurations of a pin map, and registers full of ones")
+    {
+        static const GpioPortConfig_t aPortConfigs[] =
+        {
+            GPIO_PORT_CONFIG(TEST_PIN_MAP, portA),
+            GPIO_PORT_CONFIG(TEST_PIN_MAP, portC)
+        };
+        const GpioConfig_t aGpios[] =
+        {
+            {.pin = {portC, 13U}, .mode = input, .isOpenDrain = false, .speed = low, .pull = pullDown,
+             .alternateFunction = af0},
+            {.pin = {portA, 0U}, .mode = output, .isOpenDrain = true, .speed = high, .pull = pullUp, .alternateFunction = af0},
+            {.pin = {portA, 9U}, .mode = alternate, .isOpenDrain = false, .speed = veryHigh, .pull = floating,
+             .alternateFunction = af7}
+        };
+        MOCK_SET_RETURN_VALUE(REG_READ_MOCK, 0xFFFFFFFFUL);
+
+        WHEN ("the port configurations are set")
+        {
+            HalGpio_SetPortConfigurations(aPortConfigs, ARRAY_LENGTH(aPortConfigs, GpioPortConfig_t));
+
+            THEN ("no errors shall occur")
+            {
+                REQUIRE (NO_ASSERT_ERRORS);
+
+                AND_THEN ("the clocks shall be enabled and each register shall be read and written once")
+                {
+                    REQUIRE (MOCK_CALLS(SET_BIT_MOCK) == 2U);
+                    REQUIRE (MOCK_ARG_HISTORY(SET_BIT_MOCK, 1, 0) == RCC_AHB1ENR_GPIOAEN_Pos);
+                    REQUIRE (MOCK_ARG_HISTORY(SET_BIT_MOCK, 1, 1) == RCC_AHB1ENR_GPIOCEN_Pos);
+                    REQUIRE (MOCK_CALLS(REG_READ_MOCK) == 11U);
+                    REQUIRE (MOCK_CALLS(REG_WRITE_MOCK) == 11U);
+                }
+
+                AND_THEN ("the registers shall be written as when the pins are configured at run-time")
+                {
+                    uint32_t* apRegisters[11];
+                    uint32_t aValues[11];
+                    for (uint32_t i = 0UL; i < 11UL; ++i)
+                    {
+                        apRegisters[i] = MOCK_ARG_HISTORY(REG_WRITE_MOCK, 0, i);
+                        aValues[i] = MOCK_ARG_HISTORY(REG_WRITE_MOCK, 1, i);
+                    }
+
+                    HAL_MOCK_RESET();
+                    MOCK_SET_RETURN_VALUE(REG_READ_MOCK, 0xFFFFFFFFUL);
+                    HalGpio_SetConfigurationArray(aGpios, ARRAY_LENGTH(aGpios, GpioConfig_t));
+                    REQUIRE (MOCK_CALLS(REG_WRITE_MOCK) == 11U);
+                    for (uint32_t i = 0UL; i < 11UL; ++i)
+                    {
+                        REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 0, i) == apRegisters[i]);
+                        REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 1, i) == aValues[i]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("GPIO port configurations are set erroneously", "[hal][gpio][error_handling]")
+{
+    INIT_MOCKS();
+    SYSTEM_MOCK_RESET();
+    HAL_MOCK_RESET();
+
+    GIVEN ("port configurations with an invalid port after a valid one")
+    {
+        GpioPortConfig_t aPortConfigs[2] = {};
+        aPortConfigs[0].port = portA;
+        aPortConfigs[1].port = static_cast<GpioPort_t>((int)portK + 1);
+
+        WHEN ("the port configurations are set")
+        {
+            HalGpio_SetPortConfigurations(aPortConfigs, 2UL);
+
+            THEN ("assert error shall occur and no port shall be configured")
+            {
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_GPIO_FAILURE));
+                REQUIRE (MOCK_CALLS(SET_BIT_MOCK) == 0U);
+                REQUIRE (MOCK_CALLS(REG_WRITE_MOCK) == 0U);
+            }
+        }
+    }
+
+    GIVEN ("port configurations are not created")
+    {
+        WHEN ("the port configurations are set from null array")
+        {
+            HalGpio_SetPortConfigurations(NULL, 1UL);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_GPIO_FAILURE));
+            }
+        }
+    }
+}
+
 //------------------------------------
 // HalGpio_SetOutputState
 //------------------------------------
@@ -435,6 +766,87 @@ SCENARIO ("GPIO output state is set erroneously", "[hal][gpio][error_handling]")
     }
 }
 
+//------------------------------------
+// HalGpio_WritePortMasked
+//------------------------------------
+
+SCENARIO ("GPIO port is written through a mask", "[hal][gpio]")
+{
+    INIT_MOCKS();
+    SYSTEM_MOCK_RESET();
+    HAL_MOCK_RESET();
+
+    GIVEN ("a random port")
+    {
+        GpioPort_t port = static_cast<GpioPort_t>(UTestHelper::GetRandomInt(0, (int)portK + 1));
+        GPIO_TypeDef* registers = Helper_GetCorrespondingGpioStruct(port);
+
+        WHEN ("the masked pins are written")
+        {
+            HalGpio_WritePortMasked(port, 0x0FF0U, 0x5A5AU);
+
+            THEN ("no errors shall occur")
+            {
+                REQUIRE (NO_ASSERT_ERRORS);
+
+                AND_THEN ("the masked pins shall be set and reset with a single BSRR write")
+                {
+                    REQUIRE (MOCK_CALLS(REG_WRITE_MOCK) == 1U);
+                    REQUIRE (MOCK_CALLS(SET_BIT_MOCK) == 0U);
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 0, 0) == &registers->BSRR);
+                    REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 1, 0) == 0x0A50UL + (0x05A0UL << GPIO_BSRR_BR0_Pos));
+                }
+            }
+        }
+
+        WHEN ("all pins are written")
+        {
+            HalGpio_WritePortMasked(port, 0xFFFFU, 0x8001U);
+
+            THEN ("every pin shall be either set or reset")
+            {
+                REQUIRE (NO_ASSERT_ERRORS);
+                REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 1, 0) == 0x8001UL + (0x7FFEUL << GPIO_BSRR_BR0_Pos));
+            }
+        }
+
+        WHEN ("no pins are masked")
+        {
+            HalGpio_WritePortMasked(port, 0x0000U, 0xFFFFU);
+
+            THEN ("the write shall leave all pins untouched")
+            {
+                REQUIRE (NO_ASSERT_ERRORS);
+                REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 1, 0) == 0UL);
+            }
+        }
+    }
+}
+
+SCENARIO ("GPIO port is written erroneously", "[hal][gpio][error_handling]")
+{
+    INIT_MOCKS();
+    SYSTEM_MOCK_RESET();
+    HAL_MOCK_RESET();
+
+    GIVEN ("an invalid port")
+    {
+        GpioPort_t port = static_cast<GpioPort_t>((int)portK + 1);
+
+        WHEN ("the port is written")
+        {
+            HalGpio_WritePortMasked(port, 0xFFFFU, 0x0000U);
+
+            THEN ("assert error shall occur and no register shall be written")
+            {
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(HAL_GPIO_FAILURE));
+                REQUIRE (MOCK_CALLS(REG_WRITE_MOCK) == 0U);
+            }
+        }
+    }
+}
+
 //------------------------------------
 // HalGpio_GetInputState
 //------------------------------------
@@ -23,7 +23,16 @@
 //! 
 //! @brief   This is an example of a voltage supervisor module.
 //! The module monitors voltage of 12V line and raises a system level warning flag and pulls an alarm line low
-//! if the voltage is outside acceptable limits.
+//! if the voltage is outside acceptable limits. The voltage is sampled by a timer triggered ADC scan into a buffer of two
+//! blocks, one average each. The ADC block callback resumes the supervisor task, which averages the whole block in task
+//! context, so the CPU does no work per sample. The analog watchdog of the ADC guards the same channel against the
+//! warning limits in hardware, so a single sample outside the limits resumes the task at once instead of waiting for the
+//! average. The watchdog is disarmed by the first such sample and armed again when the warnings have been cleared.
+//! While a warning is active the scan runs at a faster rate, and a warning is cleared only after the voltage has stayed
+//! within its recovery limit for the recovery delay. The delay is a one-shot scheduler timer that is restarted and
+//! stopped as the voltage moves. The supervisor task is a coroutine that goes through this sequence: it waits until a
+//! warning is raised, speeds up the scan, waits until the warnings have been cleared, slows the scan down and arms the
+//! watchdog again.
 
 //-----------------------------------------------------------------------------------------------------------------------------
 // Includes
@@ -31,6 +40,7 @@
 
 #include "supervisor.h"
 #include "adc.h"
+#include "coroutine.h"
 #include "scheduler.h"
 #include "system.h"
 #include "gpio.h"
@@ -40,19 +50,69 @@
 // Defines
 //-----------------------------------------------------------------------------------------------------------------------------
 
-#define SUPERVISOR_TASK_INTERVAL        100U    //!< A supervisor task interval in milliseconds.
-#define SUPERVISOR_ADC_CHANNEL          ADC1    //!< A supervisor ADC channel.
+#define SUPERVISOR_SAMPLE_RATE          10UL    //!< Samples per second.
+#define SUPERVISOR_FAST_SAMPLE_RATE     100UL   //!< Samples per second while a warning is active.
+#define SUPERVISOR_RECOVERY_DELAY       2000UL  //!< Time in milliseconds the voltage must stay recovered.
+#define SUPERVISOR_ADC_CHANNEL          ADC_CHANNEL_1   //!< A supervisor ADC channel.
+#define SUPERVISOR_ADC_TRIGGER          ADC_TRIGGER_TIM2_TRGO   //!< A timer that triggers the supervisor samples.
+#ifndef SUPERVISOR_ADC_RESOLUTION
+#define SUPERVISOR_ADC_RESOLUTION       ADC_RES_12_BIT  //!< Resolution of the supervisor samples.
+#endif
+#define SUPERVISOR_ADC_SAMPLE_TIME      ADC_SAMPLE_TIME_84_CYCLES   //!< Sample time of the voltage divider.
 #define SUPERVISOR_ALARM_PORT           portC   //!< A supervisor alarm GPIO port.
 #define SUPERVISOR_ALARM_PIN_NUMBER     5U      //!< A supervisor alarm GPIO pin number.
 
-#define SAMPLE_LIMIT                    10U     //<! Number of samples per average. Totals in 100ms * 10 = 1000ms per average.
-#define ADC_MAX                         0xFFFUL //<! Maximum ADC value.
+#define SAMPLE_LIMIT                    10U     //<! Number of samples per average, i.e. per ADC block. Totals in 100ms * 10 =
+                                                //<! 1000ms per average.
+#define ADC_MAX                         ADC_MAX_VALUE(SUPERVISOR_ADC_RESOLUTION)  //<! Maximum ADC value.
 #define SUPERVISOR_VOLTAGE_AT_MAX_ADC   2000UL  //<! Supervised voltage in 0.01 resolution at maximum ADC value.
 #define SUPERVISOR_UV_LIMIT             1050U   //<! Voltage limit for undervoltage
 #define SUPERVISOR_UV_RECOVERY_LIMIT    1100U   //<! Voltage limit for undervoltage recovery
 #define SUPERVISOR_OV_LIMIT             1350U   //<! Voltage limit for overvoltage
 #define SUPERVISOR_OV_RECOVERY_LIMIT    1300U   //<! Voltage limit for overvoltage recovery
 
+#define SUPERVISOR_ADC_OFFSET           0L      //<! ADC offset error in counts. Subtracted from the results.
+#define SUPERVISOR_ADC_GAIN             65536L  //<! ADC gain correction in 1/65536. 65536 corrects nothing.
+//! INL correction in ADC counts at a knot of the calibration table, added to the results after the offset. The
+//! corrections are measured per board and shall keep the calibrated voltage increasing. The nominal board has none.
+#define SUPERVISOR_ADC_INL(knot_)       0L
+
+#define CALIBRATION_INTERVAL_BITS       6U      //<! Number of calibration intervals as a power of two.
+//! ADC counts between the calibration knots as a power of two. The table has the same number of intervals at every
+//! resolution, so the knots move further apart as the resolution grows.
+#define CALIBRATION_KNOT_SHIFT          (ADC_RESOLUTION_BITS(SUPERVISOR_ADC_RESOLUTION) - CALIBRATION_INTERVAL_BITS)
+#define CALIBRATION_FRACTION_BITS       16U     //<! Fraction bits of the calibrated voltages.
+#define CALIBRATION_KNOT_COUNT          ((ADC_MAX >> CALIBRATION_KNOT_SHIFT) + 2UL)   //<! Knots up to ADC_MAX + 1.
+
+//! Calibrated voltage at a knot with CALIBRATION_FRACTION_BITS fraction bits. Voltages below 0 are clamped to 0.
+#define CALIBRATION_COUNTS(knot_)       ((((int64_t)(knot_) << CALIBRATION_KNOT_SHIFT) - SUPERVISOR_ADC_OFFSET + \
+                                          SUPERVISOR_ADC_INL(knot_)) * SUPERVISOR_ADC_GAIN)
+#define CALIBRATION_KNOT(knot_)         ((CALIBRATION_COUNTS(knot_) < 0) ? 0UL : \
+                                         (uint32_t)(((CALIBRATION_COUNTS(knot_) * (int64_t)SUPERVISOR_VOLTAGE_AT_MAX_ADC) + \
+                                                     (int64_t)(ADC_MAX / 2UL)) / (int64_t)ADC_MAX))
+#define CALIBRATION_KNOTS_8(first_)     CALIBRATION_KNOT((first_)), CALIBRATION_KNOT((first_) + 1U), \
+                                        CALIBRATION_KNOT((first_) + 2U), CALIBRATION_KNOT((first_) + 3U), \
+                                        CALIBRATION_KNOT((first_) + 4U), CALIBRATION_KNOT((first_) + 5U), \
+                                        CALIBRATION_KNOT((first_) + 6U), CALIBRATION_KNOT((first_) + 7U)
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Typedefs
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief A context of the supervisor task.
+typedef struct
+{
+    AdcChannel_t channel;                   //!< Supervised ADC channel.
+    uint32_t scanRate;                      //!< Samples per second of the running scan.
+    const uint16_t* volatile pBlock;        //!< A block of ADC results set by the ADC callback. NULL if the task
+                                            //!< has processed the latest block.
+    volatile uint32_t blockLength;          //!< Number of samples in the block.
+    volatile bool isWatchdogTriggered;      //!< A flag set by the watchdog callback when a sample left the limits.
+    volatile uint16_t watchdogSample;       //!< The ADC result that left the limits.
+    bool isWatchdogArmed;                   //!< A flag indicating that the analog watchdog is armed.
+    Coroutine_t coroutine;                  //!< The resume point of the supervisor sequence.
+} SupervisorTask_t;
+
 //-----------------------------------------------------------------------------------------------------------------------------
 // Static Variables
 //-----------------------------------------------------------------------------------------------------------------------------
@@ -60,9 +120,29 @@
 /// @brief Alarm GPIO pin.
 staticv const GpioPin_t alarmPin = {.port = SUPERVISOR_ALARM_PORT, .number = SUPERVISOR_ALARM_PIN_NUMBER};
 
+/// @brief The supervisor task context. Given to the supervisor task as its context.
+staticv SupervisorTask_t supervisorTask = {.channel = SUPERVISOR_ADC_CHANNEL, .scanRate = SUPERVISOR_SAMPLE_RATE};
+
+/// @brief The ADC calibration table. Each knot holds the calibrated voltage of an ADC value that is a multiple of the
+/// knot distance, and the voltages between the knots are interpolated. The table is generated by the compiler from the
+/// gain, offset and INL corrections, so it is stored in flash.
+staticv const uint32_t aCalibration[] =
+{
+    CALIBRATION_KNOTS_8(0U), CALIBRATION_KNOTS_8(8U), CALIBRATION_KNOTS_8(16U), CALIBRATION_KNOTS_8(24U),
+    CALIBRATION_KNOTS_8(32U), CALIBRATION_KNOTS_8(40U), CALIBRATION_KNOTS_8(48U), CALIBRATION_KNOTS_8(56U),
+    CALIBRATION_KNOT(64U)
+};
+
+_Static_assert(UTILS_ARRAY_LENGTH(aCalibration, uint32_t) == CALIBRATION_KNOT_COUNT,
+               "The calibration table initializer must have a knot for every interval and one past ADC_MAX.");
+
+/// @brief The ADC scan buffer of two blocks.
+staticv uint16_t aSampleBuffer[2U * SAMPLE_LIMIT];
+
+staticv TaskHandle_t taskHandle = 0UL;  //<! A handle of the supervisor task.
+staticv TaskHandle_t recoveryHandle = 0UL;  //<! A handle of the recovery timer task.
+staticv bool isRecoveryPending = false; //<! A flag indicating that the recovery timer is running.
 staticv bool isInitialised = false; //<! A flag indicating if the module has been initialised successfully.
-staticv uint8_t samples = 0U;       //<! Number of samples in sampleSum.
-staticv uint16_t sampleSum = 0U;    //<! Sum of samples.
 staticv uint16_t voltage = 0U;      //<! Latest measured voltage.
 staticv bool uvIsActive = false;    //<! A flag indicating if undervoltage is active.
 staticv bool ovIsActive = false;    //<! A flag indicating if overvoltage is active.
@@ -71,18 +151,67 @@ staticv bool ovIsActive = false;    //<! A flag indicating if overvoltage is act
 // Static Function Prototypes
 //-----------------------------------------------------------------------------------------------------------------------------
 
-/// @brief A callback for ADC measurement.
-/// @param result - 12-bit ADC result.
-staticf void Supervisor_AdcCallback(uint16_t result);
+/// @brief A callback for ADC blocks. Called from the DMA interrupt.
+/// @param pSamples - A pointer to the block of ADC results.
+/// @param sampleCount - Number of samples in the block.
+staticf void Supervisor_AdcCallback(const uint16_t* pSamples, uint32_t sampleCount);
+
+/// @brief A callback for the analog watchdog. Called from the ADC interrupt.
+/// @param result - The ADC result outside the warning limits.
+staticf void Supervisor_WatchdogCallback(uint16_t result);
+
+/// @brief This function arms the analog watchdog on the supervised channel with the warning limits.
+/// @param pTask - A pointer to the supervisor task context.
+/// @return Returns a corresponding error code. See types.h.
+staticf Error_t Supervisor_ArmWatchdog(SupervisorTask_t* pTask);
 
-/// @brief A supervisor task that triggers a ADC conversion.
-staticf void Supervisor_Task(void);
+/// @brief This function starts the ADC scan of the supervisor at the scan rate of the task context.
+/// @param pTask - A pointer to the supervisor task context.
+/// @return Returns a corresponding error code. See types.h.
+staticf Error_t Supervisor_StartScan(const SupervisorTask_t* pTask);
 
-/// @brief This function converts a given 12-bit ADC value into voltage.
-/// @param adc - 12-bit ADC value.
+/// @brief This function restarts the ADC scan of the supervisor at a given scan rate if it runs at another rate.
+/// @param pTask - A pointer to the supervisor task context.
+/// @param scanRate - Samples per second.
+staticf void Supervisor_SetScanRate(SupervisorTask_t* pTask, uint32_t scanRate);
+
+/// @brief This function averages a block of ADC results into the voltage and updates the warnings.
+/// @param pSamples - A pointer to the block of ADC results.
+/// @param sampleCount - Number of samples in the block.
+staticf void Supervisor_ProcessSamples(const uint16_t* pSamples, uint32_t sampleCount);
+
+/// @brief This function processes the watchdog sample and the latest block handed over by the callbacks.
+/// @param pTask - A pointer to the supervisor task context.
+/// @return Returns true if a warning is active.
+staticf bool Supervisor_ProcessInputs(SupervisorTask_t* pTask);
+
+/// @brief A supervisor task that is resumed by the ADC and watchdog callbacks. It is a coroutine that processes the
+/// inputs on every call, changes the scan rate when a warning is raised or cleared and re-arms the watchdog.
+/// @param pContext - A pointer to the supervisor task context.
+staticf void Supervisor_Task(void* pContext);
+
+/// @brief A one-shot task that clears the warnings whose recovery limit has held for the recovery delay.
+/// @param pContext - Not used.
+staticf void Supervisor_RecoveryTask(void* pContext);
+
+/// @brief This function checks if an active warning has reached its recovery limit.
+/// @return Returns true if a warning is recovering.
+staticf bool Supervisor_IsRecovering(void);
+
+/// @brief This function updates the alarm line to match the warnings.
+staticf void Supervisor_UpdateAlarm(void);
+
+/// @brief This function converts a given ADC value at the supervisor resolution into calibrated voltage.
+/// @param adc - ADC value.
 /// @return Returns supervides voltage in resolution of 0.01.
 staticf uint16_t Supervisor_AdcToVoltage(uint16_t adc);
 
+/// @brief This function finds the lowest ADC value that Supervisor_AdcToVoltage() converts into a given voltage or
+/// above.
+/// @param voltage - Voltage in resolution of 0.01.
+/// @return Returns the ADC value or ADC_MAX + 1 if no ADC value reaches the voltage.
+staticf uint16_t Supervisor_VoltageToAdc(uint16_t voltage);
+
 /// @brief This function updates the warning flag statuses based on the latest measurement.
 staticf void Supervisor_UpdateWarnings(void);
 
@@ -92,14 +221,6 @@ staticf void Supervisor_UpdateWarnings(void);
 
 void Supervisor_Init(void)
 {
-    const AdcConfig_t adcConfig =
-    {
-        .channel = SUPERVISOR_ADC_CHANNEL,
-        .resolution = ADC_RES_12_BIT,
-        .Callback = Supervisor_AdcCallback
-    };
-    HalAdc_SetConfiguration(&adcConfig);
-
     const GpioConfig_t gpioConfig =
     {
         .pin = {.port = SUPERVISOR_ALARM_PORT, .number = SUPERVISOR_ALARM_PIN_NUMBER},
@@ -119,10 +240,42 @@ Error_t Supervisor_Start(void)
     Error_t error;
     if (isInitialised)
     {
-        samples = 0U;
-        sampleSum = 0U;
         voltage = 0U;
-        error = Scheduler_CreateTask(Supervisor_Task, SUPERVISOR_TASK_INTERVAL);
+        isRecoveryPending = false;
+        supervisorTask.pBlock = NULL;
+        supervisorTask.isWatchdogTriggered = false;
+        supervisorTask.scanRate = (uvIsActive || ovIsActive) ? SUPERVISOR_FAST_SAMPLE_RATE : SUPERVISOR_SAMPLE_RATE;
+        COROUTINE_RESET(&supervisorTask.coroutine);
+        const TaskConfig_t recoveryConfig = {.Task = Supervisor_RecoveryTask, .pContext = NULL};
+        error = Scheduler_CreateOneShot(&recoveryConfig, &recoveryHandle);
+        if (error == ERROR_OK)
+        {
+            // The task has no interval of its own, it is called whenever the ADC callback resumes it.
+            const TaskConfig_t taskConfig = {.Task = Supervisor_Task, .pContext = &supervisorTask};
+            error = Scheduler_CreateOneShot(&taskConfig, &taskHandle);
+            if (error == ERROR_OK)
+            {
+                error = Supervisor_StartScan(&supervisorTask);
+                if (error == ERROR_OK)
+                {
+                    error = Supervisor_ArmWatchdog(&supervisorTask);
+                    if (error != ERROR_OK)
+                    {
+                        (void)HalAdc_StopScan();
+                    }
+                }
+
+                if (error != ERROR_OK)
+                {
+                    (void)Scheduler_DeleteTask(taskHandle);
+                }
+            }
+
+            if (error != ERROR_OK)
+            {
+                (void)Scheduler_DeleteTask(recoveryHandle);
+            }
+        }
     }
     else
     {
@@ -136,9 +289,18 @@ Error_t Supervisor_Stop(void)
     Error_t error;
     if (isInitialised)
     {
-        error = Scheduler_DeleteTask(Supervisor_Task);
-        samples = 0U;
-        sampleSum = 0U;
+        HalAdc_DisableWatchdog();
+        supervisorTask.isWatchdogArmed = false;
+        supervisorTask.isWatchdogTriggered = false;
+        error = HalAdc_StopScan();
+        Error_t taskError = Scheduler_DeleteTask(taskHandle);
+        Error_t recoveryError = Scheduler_DeleteTask(recoveryHandle);
+        if (error == ERROR_OK)
+        {
+            error = (taskError != ERROR_OK) ? taskError : recoveryError;
+        }
+        isRecoveryPending = false;
+        supervisorTask.pBlock = NULL;
         voltage = 0U;
     }
     else
@@ -157,22 +319,24 @@ uint16_t Supervisor_GetVoltage(void)
 // Static Function Definitions
 //-----------------------------------------------------------------------------------------------------------------------------
 
-staticf void Supervisor_AdcCallback(uint16_t result)
+staticf void Supervisor_AdcCallback(const uint16_t* pSamples, uint32_t sampleCount)
 {
-    sampleSum += result;
-    if (++samples >= SAMPLE_LIMIT)
+    // The block stays valid for one block period, which is far longer than the task takes to run.
+    supervisorTask.blockLength = sampleCount;
+    supervisorTask.pBlock = pSamples;
+    Error_t error = Scheduler_ResumeTask(taskHandle);
+    if (error != ERROR_OK)
     {
-        voltage = Supervisor_AdcToVoltage(UTILS_DIVIDE_AND_ROUND(sampleSum, samples));
-        sampleSum = 0U;
-        samples = 0U;
-        Supervisor_UpdateWarnings();
+        System_RaiseError(SUPERVISOR_FAILURE);
     }
     return;
 }
 
-staticf void Supervisor_Task(void)
+staticf void Supervisor_WatchdogCallback(uint16_t result)
 {
-    Error_t error = HalAdc_StartConversion(SUPERVISOR_ADC_CHANNEL);
+    supervisorTask.watchdogSample = result;
+    supervisorTask.isWatchdogTriggered = true;
+    Error_t error = Scheduler_ResumeTask(taskHandle);
     if (error != ERROR_OK)
     {
         System_RaiseError(SUPERVISOR_FAILURE);
@@ -180,55 +344,217 @@ staticf void Supervisor_Task(void)
     return;
 }
 
-staticf uint16_t Supervisor_AdcToVoltage(uint16_t adc)
+staticf Error_t Supervisor_ArmWatchdog(SupervisorTask_t* pTask)
 {
-    return (uint16_t)UTILS_DIVIDE_AND_ROUND((uint32_t)adc * SUPERVISOR_VOLTAGE_AT_MAX_ADC, ADC_MAX);
+    // The thresholds are the last ADC values that are converted inside the warning limits, so the watchdog fires on
+    // exactly the samples that raise a warning.
+    const AdcWatchdogConfig_t watchdogConfig =
+    {
+        .channel = pTask->channel,
+        .lowThreshold = Supervisor_VoltageToAdc(SUPERVISOR_UV_LIMIT),
+        .highThreshold = (uint16_t)(Supervisor_VoltageToAdc(SUPERVISOR_OV_LIMIT + 1U) - 1U),
+        .Callback = Supervisor_WatchdogCallback
+    };
+    Error_t error = HalAdc_EnableWatchdog(&watchdogConfig);
+    pTask->isWatchdogArmed = (error == ERROR_OK);
+    return error;
 }
 
-staticf void Supervisor_UpdateWarnings(void)
+staticf Error_t Supervisor_StartScan(const SupervisorTask_t* pTask)
 {
-    bool alarmChange = false;
-    if (uvIsActive)
+    const AdcScanConfig_t scanConfig =
     {
-        if (voltage >= SUPERVISOR_UV_RECOVERY_LIMIT)
+        .pChannels = &pTask->channel,
+        .channelCount = 1UL,
+        .resolution = SUPERVISOR_ADC_RESOLUTION,
+        .sampleTime = SUPERVISOR_ADC_SAMPLE_TIME,
+        .pBuffer = aSampleBuffer,
+        .bufferLength = UTILS_ARRAY_LENGTH(aSampleBuffer, uint16_t),
+        .Callback = Supervisor_AdcCallback,
+        .trigger = SUPERVISOR_ADC_TRIGGER,
+        .scanRate = pTask->scanRate
+    };
+    return HalAdc_StartScan(&scanConfig);
+}
+
+staticf void Supervisor_ProcessSamples(const uint16_t* pSamples, uint32_t sampleCount)
+{
+    if (sampleCount > 0UL)
+    {
+        uint32_t sum = 0UL;
+        for (uint32_t i = 0UL; i < sampleCount; ++i)
         {
-            System_ClearWarning(UNDERVOLTAGE_WARNING);
-            uvIsActive = false;
-            alarmChange = true;
+            sum += pSamples[i];
         }
+        voltage = Supervisor_AdcToVoltage((uint16_t)UTILS_DIVIDE_AND_ROUND(sum, sampleCount));
+        Supervisor_UpdateWarnings();
     }
-    else
+    return;
+}
+
+staticf void Supervisor_SetScanRate(SupervisorTask_t* pTask, uint32_t scanRate)
+{
+    if (scanRate != pTask->scanRate)
+    {
+        pTask->scanRate = scanRate;
+        if ((HalAdc_StopScan() != ERROR_OK) || (Supervisor_StartScan(pTask) != ERROR_OK))
+        {
+            System_RaiseError(SUPERVISOR_FAILURE);
+        }
+    }
+    return;
+}
+
+staticf bool Supervisor_ProcessInputs(SupervisorTask_t* pTask)
+{
+    if (pTask->isWatchdogTriggered)
+    {
+        // The watchdog has disarmed itself. The sample raises its warning without waiting for the average.
+        pTask->isWatchdogTriggered = false;
+        pTask->isWatchdogArmed = false;
+        voltage = Supervisor_AdcToVoltage(pTask->watchdogSample);
+        Supervisor_UpdateWarnings();
+    }
+
+    const uint16_t* pBlock = pTask->pBlock;
+    if (pBlock != NULL)
     {
-        if (voltage < SUPERVISOR_UV_LIMIT)
+        pTask->pBlock = NULL;
+        Supervisor_ProcessSamples(pBlock, pTask->blockLength);
+    }
+    return (uvIsActive || ovIsActive);
+}
+
+staticf void Supervisor_Task(void* pContext)
+{
+    SupervisorTask_t* pTask = (SupervisorTask_t*)pContext;
+    COROUTINE_BEGIN(&pTask->coroutine);
+    while (true)
+    {
+        COROUTINE_WAIT_UNTIL(&pTask->coroutine, Supervisor_ProcessInputs(pTask));
+        Supervisor_SetScanRate(pTask, SUPERVISOR_FAST_SAMPLE_RATE);
+
+        // The watchdog stays disarmed during a warning, since the voltage is then outside the limits on every sample.
+        // The warnings are cleared by the recovery task, and the next input after that ends the wait.
+        COROUTINE_WAIT_UNTIL(&pTask->coroutine, (Supervisor_ProcessInputs(pTask) == false));
+        Supervisor_SetScanRate(pTask, SUPERVISOR_SAMPLE_RATE);
+        if (Supervisor_ArmWatchdog(pTask) != ERROR_OK)
         {
-            System_RaiseWarning(UNDERVOLTAGE_WARNING);
-            uvIsActive = true;
-            alarmChange = true;
+            System_RaiseError(SUPERVISOR_FAILURE);
         }
     }
+    COROUTINE_END(&pTask->coroutine);
+    return;
+}
 
-    if (ovIsActive)
+staticf uint16_t Supervisor_AdcToVoltage(uint16_t adc)
+{
+    uint32_t value = (adc > ADC_MAX) ? ADC_MAX : (uint32_t)adc;
+    uint32_t knot = value >> CALIBRATION_KNOT_SHIFT;
+    uint32_t fraction = value & ((1UL << CALIBRATION_KNOT_SHIFT) - 1UL);
+    uint32_t step = aCalibration[knot + 1UL] - aCalibration[knot];
+    uint32_t calibrated = aCalibration[knot] + ((step * fraction) >> CALIBRATION_KNOT_SHIFT);
+    return (uint16_t)((calibrated + (1UL << (CALIBRATION_FRACTION_BITS - 1U))) >> CALIBRATION_FRACTION_BITS);
+}
+
+staticf uint16_t Supervisor_VoltageToAdc(uint16_t voltage)
+{
+    // The calibrated voltage increases with the ADC value, so the value is found by a binary search.
+    uint32_t low = 0UL;
+    uint32_t high = ADC_MAX + 1UL;
+    while (low < high)
     {
-        if (voltage <= SUPERVISOR_OV_RECOVERY_LIMIT)
+        uint32_t middle = (low + high) / 2UL;
+        if (Supervisor_AdcToVoltage((uint16_t)middle) < voltage)
         {
-            System_ClearWarning(OVERVOLTAGE_WARNING);
-            ovIsActive = false;
-            alarmChange = true;
+            low = middle + 1UL;
+        }
+        else
+        {
+            high = middle;
         }
     }
-    else
+    return (uint16_t)low;
+}
+
+staticf void Supervisor_UpdateWarnings(void)
+{
+    bool alarmChange = false;
+    if ((uvIsActive == false) && (voltage < SUPERVISOR_UV_LIMIT))
+    {
+        System_RaiseWarning(UNDERVOLTAGE_WARNING);
+        uvIsActive = true;
+        alarmChange = true;
+    }
+
+    if ((ovIsActive == false) && (voltage > SUPERVISOR_OV_LIMIT))
+    {
+        System_RaiseWarning(OVERVOLTAGE_WARNING);
+        ovIsActive = true;
+        alarmChange = true;
+    }
+
+    // The recovery delay starts when the voltage reaches a recovery limit and is cancelled if it leaves the limit.
+    bool isRecovering = Supervisor_IsRecovering();
+    if (isRecovering != isRecoveryPending)
     {
-        if (voltage > SUPERVISOR_OV_LIMIT)
+        Error_t error;
+        if (isRecovering)
+        {
+            error = Scheduler_StartTimer(recoveryHandle, SUPERVISOR_RECOVERY_DELAY);
+        }
+        else
+        {
+            error = Scheduler_StopTimer(recoveryHandle);
+        }
+        if (error != ERROR_OK)
         {
-            System_RaiseWarning(OVERVOLTAGE_WARNING);
-            ovIsActive = true;
-            alarmChange = true;
+            System_RaiseError(SUPERVISOR_FAILURE);
         }
+        isRecoveryPending = isRecovering;
     }
 
     if (alarmChange)
     {
-        HalGpio_SetOutputState(&alarmPin, (uvIsActive || ovIsActive));
+        Supervisor_UpdateAlarm();
+    }
+    return;
+}
+
+staticf void Supervisor_RecoveryTask(void* pContext)
+{
+    (void)pContext;
+    bool alarmChange = false;
+    if (uvIsActive && (voltage >= SUPERVISOR_UV_RECOVERY_LIMIT))
+    {
+        System_ClearWarning(UNDERVOLTAGE_WARNING);
+        uvIsActive = false;
+        alarmChange = true;
     }
+
+    if (ovIsActive && (voltage <= SUPERVISOR_OV_RECOVERY_LIMIT))
+    {
+        System_ClearWarning(OVERVOLTAGE_WARNING);
+        ovIsActive = false;
+        alarmChange = true;
+    }
+
+    isRecoveryPending = false;
+    if (alarmChange)
+    {
+        Supervisor_UpdateAlarm();
+    }
+    return;
+}
+
+staticf bool Supervisor_IsRecovering(void)
+{
+    return ((uvIsActive && (voltage >= SUPERVISOR_UV_RECOVERY_LIMIT)) ||
+            (ovIsActive && (voltage <= SUPERVISOR_OV_RECOVERY_LIMIT)));
+}
+
+staticf void Supervisor_UpdateAlarm(void)
+{
+    HalGpio_SetOutputState(&alarmPin, (uvIsActive || ovIsActive));
     return;
 }
@@ -0,0 +1,22 @@
+add_executable(run_rta_supervisor
+               ${CMAKE_CURRENT_LIST_DIR}/rta_supervisor.cpp
+               ${CMAKE_CURRENT_LIST_DIR}/../../CMSIS/mocks/stm32f429xx_mock.c
+               ${CMAKE_CURRENT_LIST_DIR}/../../System/sources/schedulability.c
+               ${CMAKE_CURRENT_LIST_DIR}/../../System/sources/scheduler.c
+               ${CMAKE_CURRENT_LIST_DIR}/../sources/supervisor.c)
+
+target_include_directories(run_rta_supervisor PUBLIC
+                           "${CMAKE_CURRENT_LIST_DIR}/../../../TestingUtils/FFF"
+                           "${CMAKE_CURRENT_LIST_DIR}/../../CMSIS/include"
+                           "${CMAKE_CURRENT_LIST_DIR}/../../CMSIS/mocks"
+                           "${CMAKE_CURRENT_LIST_DIR}/../../HAL/include"
+                           "${CMAKE_CURRENT_LIST_DIR}/../../HAL/mocks"
+                           "${CMAKE_CURRENT_LIST_DIR}/../../System/include"
+                           "${CMAKE_CURRENT_LIST_DIR}/../../System/mocks"
+                           "${CMAKE_CURRENT_LIST_DIR}/../../Utils/include"
+                           "${CMAKE_CURRENT_LIST_DIR}/../include")
+
+# The analysis reads the task table of the scheduler, so its size is fixed here.
+target_compile_definitions(run_rta_supervisor PUBLIC SCHEDULER_MAX_TASKS=16U)
+
+add_test(NAME rta_supervisor COMMAND run_rta_supervisor)
@@ -0,0 +1,412 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2020 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    rta_supervisor.cpp
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    17 Oct 2026
+//! 
+//! @brief   This is an offline response-time analysis of the supervisor tasks.
+//! 
+//! The supervisor is started on the real scheduler, and every task it registers is matched with its call rate below by
+//! its handle. The execution times are not given by hand: the worst-case path of every task and interrupt handler is
+//! benchmarked on the host, the tasks through Scheduler_ResumeTask() and Scheduler_Run() so that the dispatch is
+//! included. The task set is then analysed with Schedulability_Analyse(). The program fails if a registered task has no
+//! call rate or if any task can miss its deadline, so a change that slows down the supervisor or the scheduler enough
+//! fails the run.
+//! 
+//! A path is run in batches and the fastest batch gives its time per call, so the host scheduler and cache misses do
+//! not add noise. Host nanoseconds are converted into target cycles with RTA_CYCLES_PER_HOST_NS. The register access
+//! of the HAL is mocked, so the HAL parts of the interrupt handlers are not included.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <chrono>
+#include <fff.h>
+DEFINE_FFF_GLOBALS;
+
+extern "C" {
+#include "coroutine.h"
+#include "schedulability.h"
+#include "scheduler.h"
+#include "supervisor.h"
+#include "system_stm32f4xx.h"
+#include "utils.h"
+}
+
+// Mocks
+#include "adc_mock.h"
+#include "cmsis_mock.h"
+#include "gpio_mock.h"
+#include "hal_mock.h"
+#include "system_mock.h"
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Statics of the Analysed Modules
+//-----------------------------------------------------------------------------------------------------------------------------
+
+extern "C" {
+
+/// @brief The task table entry type of the scheduler.
+typedef struct SchedulerTask
+{
+    struct SchedulerTask* pNext;
+    struct SchedulerTask** ppPrev;
+    struct SchedulerTask* pNextReady;
+    Task_t Task;
+    void* pContext;
+    uint32_t expires;
+    uint16_t interval;
+    uint16_t generation;
+    uint8_t priority;
+    bool isReady;
+    uint32_t calls;
+    uint32_t minCycles;
+    uint32_t maxCycles;
+    uint64_t totalCycles;
+    uint32_t overruns;
+} SchedulerTask_t;
+
+/// @brief The supervisor task context type.
+typedef struct
+{
+    AdcChannel_t channel;
+    uint32_t scanRate;
+    const uint16_t* volatile pBlock;
+    volatile uint32_t blockLength;
+    volatile bool isWatchdogTriggered;
+    volatile uint16_t watchdogSample;
+    bool isWatchdogArmed;
+    Coroutine_t coroutine;
+} SupervisorTask_t;
+
+extern SchedulerTask_t tasks[SCHEDULER_MAX_TASKS];
+extern volatile uint32_t ticks;
+
+extern SupervisorTask_t supervisorTask;
+extern TaskHandle_t taskHandle;
+extern TaskHandle_t recoveryHandle;
+extern bool isRecoveryPending;
+extern uint16_t voltage;
+extern bool uvIsActive;
+extern bool ovIsActive;
+
+void Supervisor_AdcCallback(const uint16_t* pSamples, uint32_t sampleCount);
+void Supervisor_WatchdogCallback(uint16_t result);
+
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Typedefs
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief A benchmarked path. Prepares the state of the path and runs it once.
+typedef void (*RtaPath_t)(void);
+
+/// @brief A call rate of a registered task.
+typedef struct
+{
+    const TaskHandle_t* pHandle;    //!< A pointer to the handle of the task.
+    const char* pName;              //!< Task name for the report.
+    RtaPath_t Path;                 //!< The worst-case path of the task.
+    uint32_t minInterval;           //!< Shortest time between two calls in milliseconds if shorter than the task
+                                    //!< interval, e.g. for tasks resumed or restarted by timers. 0 uses the interval.
+} TaskRate_t;
+
+/// @brief A call rate of an interrupt handler.
+typedef struct
+{
+    const char* pName;      //!< Handler name for the report.
+    RtaPath_t Path;         //!< The worst-case path of the handler.
+    uint32_t minInterval;   //!< Shortest time between two interrupts in milliseconds.
+    uint8_t priority;       //!< Analysis priority. SCHEDULER_PRIORITY_LEVELS and above.
+} InterruptRate_t;
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Worst-Case Paths
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief The supervisor task ends its wait for the warnings to clear: it converts a watchdog sample, averages a block,
+/// restarts the scan at the normal rate and arms the watchdog again, which searches both thresholds through the
+/// calibration.
+static void Rta_SupervisorTaskPath(void);
+
+/// @brief The recovery task clears a warning and releases the alarm line.
+static void Rta_RecoveryTaskPath(void);
+
+/// @brief The DMA interrupt hands a block to the supervisor task and resumes it.
+static void Rta_BlockInterruptPath(void);
+
+/// @brief The ADC interrupt hands a watchdog sample to the supervisor task and resumes it.
+static void Rta_WatchdogInterruptPath(void);
+
+/// @brief The SysTick interrupt cascades the wheel and expires the recovery timer on the same tick.
+static void Rta_TickInterruptPath(void);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Call Rates
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief Call rates of the registered tasks.
+static const TaskRate_t aTaskRates[] =
+{
+    // The supervisor task is resumed by the ADC once per block of 10 samples. During a warning the ADC is triggered at
+    // 100 Hz, so a block completes every 100 ms. The watchdog resumes it once more per warning.
+    {.pHandle = &taskHandle,        .pName = "Supervisor_Task",         .Path = Rta_SupervisorTaskPath, .minInterval = 100UL},
+    // The recovery timer is restarted only after it has expired, so it runs at most once per recovery delay.
+    {.pHandle = &recoveryHandle,    .pName = "Supervisor_RecoveryTask", .Path = Rta_RecoveryTaskPath,   .minInterval = 2000UL}
+};
+
+/// @brief Call rates of the interrupt handlers. The DMA interrupts once per block of ADC samples. The analog watchdog
+/// interrupts once per arming, and it is armed again only after a warning has been cleared after the recovery delay.
+static const InterruptRate_t aInterruptRates[] =
+{
+    {.pName = "DMA2_Stream0_IRQHandler",    .Path = Rta_BlockInterruptPath,     .minInterval = 100UL,   .priority = SCHEDULER_PRIORITY_LEVELS + 1U},
+    {.pName = "ADC_IRQHandler",             .Path = Rta_WatchdogInterruptPath,  .minInterval = 2000UL,  .priority = SCHEDULER_PRIORITY_LEVELS + 1U},
+    {.pName = "SysTick_Handler",            .Path = Rta_TickInterruptPath,      .minInterval = 1UL,     .priority = SCHEDULER_PRIORITY_LEVELS}
+};
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Analysis Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#define RTA_MAX_TASKS           16U     //!< Maximum number of analysed tasks and interrupt handlers.
+#define RTA_BATCHES             20U     //!< Number of benchmark batches per path.
+#define RTA_BATCH_CALLS         1000U   //!< Number of path runs per batch.
+//! Target CPU cycles charged per host nanosecond. A Cortex-M4 running from flash executes roughly one instruction per
+//! cycle and a desktop core several instructions per nanosecond, so this over-estimates the target execution time.
+#define RTA_CYCLES_PER_HOST_NS  16U
+
+static uint16_t aNominalBlock[10];      //!< A block of ADC results at the nominal voltage.
+static uint16_t aDipBlock[10];          //!< A block of ADC results below the undervoltage limit.
+static Coroutine_t recoveryWait;        //!< The supervisor task waiting for the warnings to clear.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Helper Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief This function finds the call rate of a task table entry.
+/// @param index - Task table index.
+/// @return Returns a pointer to the call rate or NULL if the task has no call rate.
+static const TaskRate_t* Rta_FindRate(uint32_t index);
+
+/// @brief This function benchmarks a path.
+/// @param Path - The path to benchmark.
+/// @return Returns the execution time of the path in target CPU cycles.
+static uint32_t Rta_Measure(RtaPath_t Path);
+
+/// @brief This function fills a block with the ADC result of a given voltage.
+/// @param pBlock - A pointer to the block of 10 samples.
+/// @param voltage - A voltage value in 0.01 resolution.
+static void Rta_FillBlock(uint16_t* pBlock, uint32_t voltage);
+
+/// @brief This function converts milliseconds into CPU cycles.
+/// @param ms - Time in milliseconds.
+/// @return Returns the time in CPU cycles.
+static uint32_t Rta_MsToCycles(uint32_t ms);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------------------------------------------------------
+
+int main(void)
+{
+    int result = 0;
+    Rta_FillBlock(aNominalBlock, 1200UL);
+    Rta_FillBlock(aDipBlock, 1000UL);
+
+    Supervisor_Init();
+    if ((Scheduler_Init() != ERROR_OK) || (Supervisor_Start() != ERROR_OK))
+    {
+        printf("Supervisor start failed.\n");
+        result = 1;
+    }
+
+    // A warning takes the supervisor task into the wait for the warnings to clear, which ends on its longest path.
+    Supervisor_AdcCallback(aDipBlock, UTILS_ARRAY_LENGTH(aDipBlock, uint16_t));
+    Scheduler_Run();
+    recoveryWait = supervisorTask.coroutine;
+
+    SchedulabilityTask_t aTasks[RTA_MAX_TASKS];
+    const char* apNames[RTA_MAX_TASKS];
+    uint32_t taskCount = 0UL;
+    for (uint32_t i = 0UL; (i < SCHEDULER_MAX_TASKS) && (taskCount < RTA_MAX_TASKS); ++i)
+    {
+        if (tasks[i].Task != NULL)
+        {
+            const TaskRate_t* pRate = Rta_FindRate(i);
+            uint32_t interval = tasks[i].interval;
+            if ((pRate != NULL) && (pRate->minInterval > 0UL) && ((interval == 0UL) || (pRate->minInterval < interval)))
+            {
+                interval = pRate->minInterval;
+            }
+
+            if ((pRate == NULL) || (interval == 0UL))
+            {
+                printf("Task %u has no call rate or no interval.\n", i);
+                result = 1;
+            }
+            else
+            {
+                aTasks[taskCount] = {};
+                aTasks[taskCount].period = Rta_MsToCycles(interval);
+                aTasks[taskCount].wcet = Rta_Measure(pRate->Path);
+                aTasks[taskCount].priority = tasks[i].priority;
+                apNames[taskCount] = pRate->pName;
+                ++taskCount;
+            }
+        }
+    }
+
+    for (const InterruptRate_t& rate : aInterruptRates)
+    {
+        aTasks[taskCount] = {};
+        aTasks[taskCount].period = Rta_MsToCycles(rate.minInterval);
+        aTasks[taskCount].wcet = Rta_Measure(rate.Path);
+        aTasks[taskCount].priority = rate.priority;
+        apNames[taskCount] = rate.pName;
+        ++taskCount;
+    }
+
+    if (Schedulability_Analyse(aTasks, taskCount) != ERROR_OK)
+    {
+        result = 1;
+    }
+
+    printf("%-26s %9s %12s %12s %14s %9s\n", "task", "priority", "wcet", "period", "response", "result");
+    for (uint32_t i = 0UL; i < taskCount; ++i)
+    {
+        printf("%-26s %9u %12u %12u %14u %9s\n", apNames[i], aTasks[i].priority, aTasks[i].wcet, aTasks[i].period,
+               aTasks[i].response, aTasks[i].isSchedulable ? "ok" : "MISS");
+        if (aTasks[i].isSchedulable == false)
+        {
+            result = 1;
+        }
+    }
+    return result;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Worst-Case Path Definitions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+static void Rta_SupervisorTaskPath(void)
+{
+    supervisorTask.coroutine = recoveryWait;
+    uvIsActive = false;
+    ovIsActive = false;
+    isRecoveryPending = false;
+    supervisorTask.scanRate = 100UL;
+    supervisorTask.isWatchdogArmed = false;
+    supervisorTask.watchdogSample = aNominalBlock[0];
+    supervisorTask.isWatchdogTriggered = true;
+    supervisorTask.blockLength = UTILS_ARRAY_LENGTH(aNominalBlock, uint16_t);
+    supervisorTask.pBlock = aNominalBlock;
+    (void)Scheduler_ResumeTask(taskHandle);
+    Scheduler_Run();
+    return;
+}
+
+static void Rta_RecoveryTaskPath(void)
+{
+    uvIsActive = true;
+    ovIsActive = false;
+    isRecoveryPending = true;
+    voltage = 1200U;
+    (void)Scheduler_ResumeTask(recoveryHandle);
+    Scheduler_Run();
+    return;
+}
+
+static void Rta_BlockInterruptPath(void)
+{
+    Supervisor_AdcCallback(aDipBlock, UTILS_ARRAY_LENGTH(aDipBlock, uint16_t));
+    return;
+}
+
+static void Rta_WatchdogInterruptPath(void)
+{
+    Supervisor_WatchdogCallback(aDipBlock[0]);
+    return;
+}
+
+static void Rta_TickInterruptPath(void)
+{
+    // The next tick is a cascade tick on which the recovery timer expires.
+    ticks = 0xFFUL;
+    (void)Scheduler_StartTimerAt(recoveryHandle, 0x100UL);
+    SysTick_Handler();
+    return;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Helper Function Definitions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+static const TaskRate_t* Rta_FindRate(uint32_t index)
+{
+    const TaskRate_t* pFound = NULL;
+    for (const TaskRate_t& rate : aTaskRates)
+    {
+        if ((*rate.pHandle & 0xFFFFUL) == index)
+        {
+            pFound = &rate;
+        }
+    }
+    return pFound;
+}
+
+static uint32_t Rta_Measure(RtaPath_t Path)
+{
+    uint64_t fastestNs = UINT64_MAX;
+    for (uint32_t batch = 0UL; batch < RTA_BATCHES; ++batch)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0UL; i < RTA_BATCH_CALLS; ++i)
+        {
+            Path();
+        }
+        auto end = std::chrono::steady_clock::now();
+        uint64_t ns = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        if (ns < fastestNs)
+        {
+            fastestNs = ns;
+        }
+
+        // The mocks record their calls, so the histories are cleared to keep the batches alike.
+        FFF_RESET_HISTORY();
+    }
+    return (uint32_t)(((fastestNs * RTA_CYCLES_PER_HOST_NS) + RTA_BATCH_CALLS - 1UL) / RTA_BATCH_CALLS);
+}
+
+static void Rta_FillBlock(uint16_t* pBlock, uint32_t voltage)
+{
+    for (uint32_t i = 0UL; i < 10UL; ++i)
+    {
+        pBlock[i] = (uint16_t)(((voltage * 0xFFFUL) + 1000UL) / 2000UL);
+    }
+    return;
+}
+
+static uint32_t Rta_MsToCycles(uint32_t ms)
+{
+    return ms * (SystemCoreClock / 1000UL);
+}
@@ -0,0 +1,637 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2020 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    sim_supervisor.cpp
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    17 Oct 2026
+//! 
+//! @brief   This is a virtual time simulation of the supervisor running on the real scheduler.
+//! 
+//! The scheduler and the supervisor are built unmodified and run on a virtual MCU. The register access, SysTick,
+//! PRIMASK, WFI and the ADC are faked so that the virtual clock advances only when the main loop executes or sleeps,
+//! and the virtual interrupts are taken at the points where the hardware would take them. Idle time is skipped by the
+//! tickless idle of the scheduler, so simulated hours take seconds of host time. The tests run the main loop through a
+//! day with a voltage profile and check the long-horizon timing of the tasks and the supervisor warnings.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#define CATCH_CONFIG_RUNNER
+#include <catch_utils.hpp>
+#include <fff.h>
+DEFINE_FFF_GLOBALS;
+#include "utest_helpers.hpp"
+
+extern "C" {
+#include "scheduler.h"
+#include "supervisor.h"
+}
+
+// Mocks
+#include "adc_mock.h"
+#include "cmsis_mock.h"
+#include "gpio_mock.h"
+#include "hal_mock.h"
+#include "system_mock.h"
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    UTestHelper::InitRandom();
+    int result = Catch::Session().run(argc, argv);
+    return result;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Simulation Parameters
+//-----------------------------------------------------------------------------------------------------------------------------
+
+static const uint64_t cyclesPerMs = 16000UL;            // SystemCoreClock of the CMSIS mock is 16 MHz.
+static const uint64_t mainLoopCycles = 200UL;           // Execution time of one main loop round.
+static const uint64_t simulatedMs = 24UL * 3600UL * 1000UL;
+
+static const uint64_t nominalVoltage = 1200UL;
+static const uint64_t dipStartMs = 6UL * 3600UL * 1000UL;
+static const uint64_t dipVoltage = 1000UL;
+static const uint64_t surgeStartMs = 18UL * 3600UL * 1000UL;
+static const uint64_t surgeVoltage = 1400UL;
+static const uint64_t disturbanceMs = 5000UL;
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Simulation Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief A virtual MCU with a SysTick timer, PRIMASK and one ADC scanning into a circular DMA buffer under an analog
+/// watchdog.
+typedef struct
+{
+    uint64_t cycles;            //!< CPU cycles since the start.
+    bool isPrimaskSet;          //!< PRIMASK, i.e. interrupts disabled.
+    bool isInterruptActive;     //!< A flag indicating that an interrupt handler is running.
+    bool isTickEnabled;         //!< SysTick enable bit.
+    bool isTickPending;         //!< SysTick interrupt pending bit.
+    uint32_t load;              //!< SysTick reload value.
+    uint32_t value;             //!< SysTick current value.
+    bool isScanning;            //!< A flag indicating that a triggered ADC scan is running.
+    uint64_t nextSample;        //!< Cycle when the next sample is transferred.
+    uint64_t samplePeriod;      //!< Cycles between two trigger events.
+    uint16_t* pScanBuffer;      //!< The circular DMA buffer.
+    uint32_t scanLength;        //!< Length of the DMA buffer in samples.
+    uint32_t sampleIndex;       //!< Index of the next transferred sample.
+    bool isDmaPending;          //!< DMA interrupt pending bit.
+    const uint16_t* pBlock;     //!< The completed half of the DMA buffer.
+    AdcBlockCallback_t BlockCallback; //!< The configured block callback.
+    bool isWatchdogArmed;       //!< A flag indicating that the analog watchdog is armed.
+    AdcWatchdogConfig_t watchdog;   //!< The configured analog watchdog.
+    bool isAdcPending;          //!< ADC interrupt pending bit.
+    uint16_t adcResult;         //!< The latest ADC result.
+    uint32_t tickInterrupts;    //!< Number of SysTick interrupts.
+    uint32_t conversions;       //!< Number of ADC conversions.
+} VirtualMcu_t;
+
+/// @brief A log of warning changes.
+typedef struct
+{
+    uint64_t raisedMs[2];       //!< Time of the last raise per warning flag.
+    uint64_t clearedMs[2];      //!< Time of the last clear per warning flag.
+    uint32_t raises;            //!< Number of raised warnings.
+    uint32_t clears;            //!< Number of cleared warnings.
+} WarningLog_t;
+
+static VirtualMcu_t mcu;
+static WarningLog_t warningLog;
+static uint32_t slowTaskCalls;
+static uint32_t fastTaskCalls;
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Helper Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief This helper function initialises the virtual MCU and installs the custom fakes.
+static void Sim_Init(void);
+
+/// @brief This helper function runs the main loop on virtual time.
+/// @param ms - Number of milliseconds to run.
+static void Sim_RunMainLoop(uint64_t ms);
+
+/// @brief This helper function executes code on the virtual MCU and takes the interrupts that occur.
+/// @param cycles - Number of cycles to execute.
+static void Sim_Execute(uint64_t cycles);
+
+/// @brief This helper function advances the virtual clock at most to the next SysTick wrap or ADC sample.
+/// @param cycles - Number of cycles to advance.
+/// @return Returns the number of cycles advanced.
+static uint64_t Sim_AdvanceClock(uint64_t cycles);
+
+/// @brief This helper function runs the pending interrupt handlers if interrupts are enabled.
+static void Sim_TakeInterrupts(void);
+
+/// @brief This helper function gets the simulated time.
+/// @return Returns the time in milliseconds.
+static uint64_t Sim_GetMs(void);
+
+/// @brief This helper function converts the supervised voltage of the profile into an ADC result.
+/// @return Returns the 12-bit ADC result.
+static uint16_t Sim_GetAdcResult(void);
+
+/// @brief A simulated task that counts its calls.
+/// @param pContext - A pointer to the call counter.
+static void Sim_CountingTask(void* pContext);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Custom Fake Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief A custom fake of REG_READ() that reads the virtual SysTick and DWT cycle counter.
+static uint32_t REG_READ_CustomFake(uint32_t* pRegister);
+
+/// @brief A custom fake of REG_WRITE() that writes the virtual SysTick.
+static void REG_WRITE_CustomFake(uint32_t* pRegister, uint32_t value);
+
+/// @brief A custom fake of SET_BIT() that enables the virtual SysTick.
+static void SET_BIT_CustomFake(uint32_t* pRegister, uint32_t bit);
+
+/// @brief A custom fake of CLEAR_BIT() that disables the virtual SysTick.
+static void CLEAR_BIT_CustomFake(uint32_t* pRegister, uint32_t bit);
+
+/// @brief A custom fake of GET_BIT() that reads the virtual SysTick pending bit.
+static bool GET_BIT_CustomFake(uint32_t* pRegister, uint32_t bit);
+
+/// @brief A custom fake of SysTick_Config() that starts the virtual SysTick.
+static uint32_t SysTick_Config_CustomFake(uint32_t ticks);
+
+/// @brief A custom fake of __WFI() that advances the virtual clock to the next interrupt.
+static void __WFI_CustomFake(void);
+
+/// @brief A custom fake of __disable_irq() that sets the virtual PRIMASK.
+static void __disable_irq_CustomFake(void);
+
+/// @brief A custom fake of __get_PRIMASK() that reads the virtual PRIMASK.
+static uint32_t __get_PRIMASK_CustomFake(void);
+
+/// @brief A custom fake of __set_PRIMASK() that takes the pending interrupts when interrupts are enabled.
+static void __set_PRIMASK_CustomFake(uint32_t priMask);
+
+/// @brief A custom fake of HalAdc_StartScan() that starts a virtual triggered scan.
+static Error_t HalAdc_StartScan_CustomFake(const AdcScanConfig_t* pConfig);
+
+/// @brief A custom fake of HalAdc_StopScan() that stops the virtual scan.
+static Error_t HalAdc_StopScan_CustomFake(void);
+
+/// @brief A custom fake of HalAdc_EnableWatchdog() that arms the virtual watchdog.
+static Error_t HalAdc_EnableWatchdog_CustomFake(const AdcWatchdogConfig_t* pConfig);
+
+/// @brief A custom fake of HalAdc_DisableWatchdog() that disarms the virtual watchdog.
+static void HalAdc_DisableWatchdog_CustomFake(void);
+
+/// @brief A custom fake of System_RaiseWarning() that logs the warning time.
+static void System_RaiseWarning_CustomFake(SystemWarningFlag_t warning);
+
+/// @brief A custom fake of System_ClearWarning() that logs the warning time.
+static void System_ClearWarning_CustomFake(SystemWarningFlag_t warning);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Test Cases
+//-----------------------------------------------------------------------------------------------------------------------------
+
+SCENARIO ("Supervisor runs for 24 hours on virtual time", "[simulation]")
+{
+    GIVEN ("the supervisor and two other tasks are started on the scheduler")
+    {
+        Sim_Init();
+        REQUIRE (Scheduler_Init() == ERROR_OK);
+        Supervisor_Init();
+        REQUIRE (Supervisor_Start() == ERROR_OK);
+
+        TaskHandle_t handle;
+        const TaskConfig_t slowConfig = {.Task = Sim_CountingTask, .pContext = &slowTaskCalls, .interval = 1000U};
+        const TaskConfig_t fastConfig = {.Task = Sim_CountingTask, .pContext = &fastTaskCalls, .interval = 250U};
+        REQUIRE (Scheduler_CreateTask(&slowConfig, &handle) == ERROR_OK);
+        REQUIRE (Scheduler_CreateTask(&fastConfig, &handle) == ERROR_OK);
+
+        WHEN ("the main loop runs for 24 hours with an undervoltage dip and an overvoltage surge")
+        {
+            Sim_RunMainLoop(simulatedMs);
+
+            THEN ("the tick count shall follow the virtual clock")
+            {
+                uint64_t expectedTicks = mcu.cycles / cyclesPerMs;
+                REQUIRE (Scheduler_GetTicks() >= expectedTicks - 1UL);
+                REQUIRE (Scheduler_GetTicks() <= expectedTicks + 1UL);
+
+                AND_THEN ("the periodic tasks shall be called on every interval after their phase")
+                {
+                    REQUIRE (slowTaskCalls >= (Scheduler_GetTicks() / 1000UL) - 1UL);
+                    REQUIRE (slowTaskCalls <= Scheduler_GetTicks() / 1000UL);
+                    REQUIRE (fastTaskCalls >= (Scheduler_GetTicks() / 250UL) - 1UL);
+                    REQUIRE (fastTaskCalls <= Scheduler_GetTicks() / 250UL);
+
+                    AND_THEN ("the voltage shall be sampled every 100 ms and faster during the warnings")
+                    {
+                        REQUIRE (mcu.conversions >= (Scheduler_GetTicks() / 100UL) - 1UL);
+                        REQUIRE (mcu.conversions <= (Scheduler_GetTicks() / 100UL) + 2000UL);
+
+                        AND_THEN ("the idle ticks shall be skipped")
+                        {
+                            REQUIRE (mcu.tickInterrupts < Scheduler_GetTicks() / 20UL);
+                        }
+                    }
+                }
+            }
+
+            THEN ("both warnings shall be raised by the watchdog within one sample period")
+            {
+                REQUIRE (warningLog.raises == 2UL);
+                REQUIRE (warningLog.raisedMs[UNDERVOLTAGE_WARNING] >= dipStartMs);
+                REQUIRE (warningLog.raisedMs[UNDERVOLTAGE_WARNING] <= dipStartMs + 100UL);
+                REQUIRE (warningLog.raisedMs[OVERVOLTAGE_WARNING] >= surgeStartMs);
+                REQUIRE (warningLog.raisedMs[OVERVOLTAGE_WARNING] <= surgeStartMs + 100UL);
+
+                AND_THEN ("the warnings shall be cleared after the recovery delay")
+                {
+                    uint64_t dipEndMs = dipStartMs + disturbanceMs;
+                    uint64_t surgeEndMs = surgeStartMs + disturbanceMs;
+                    REQUIRE (warningLog.clears == 2UL);
+                    REQUIRE (warningLog.clearedMs[UNDERVOLTAGE_WARNING] >= dipEndMs + 2000UL);
+                    REQUIRE (warningLog.clearedMs[UNDERVOLTAGE_WARNING] <= dipEndMs + 2300UL);
+                    REQUIRE (warningLog.clearedMs[OVERVOLTAGE_WARNING] >= surgeEndMs + 2000UL);
+                    REQUIRE (warningLog.clearedMs[OVERVOLTAGE_WARNING] <= surgeEndMs + 2300UL);
+
+                    AND_THEN ("the alarm line shall be released")
+                    {
+                        REQUIRE (MOCK_CALLS(HalGpio_SetOutputState) == 4);
+                        REQUIRE (MOCK_LAST_ARG(HalGpio_SetOutputState, 1) == false);
+                        REQUIRE (Supervisor_GetVoltage() == nominalVoltage);
+                        REQUIRE (MOCK_CALLS(System_RaiseError) == 0);
+                    }
+                }
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Helper Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+static void Sim_Init(void)
+{
+    FFF_RESET_HISTORY();
+    ADC_MOCK_RESET();
+    CMSIS_MOCK_RESET();
+    GPIO_MOCK_RESET();
+    HAL_MOCK_RESET();
+    SYSTEM_MOCK_RESET();
+    MOCK_SET_CUSTOM_FAKE(REG_READ_MOCK, REG_READ_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(REG_WRITE_MOCK, REG_WRITE_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(SET_BIT_MOCK, SET_BIT_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(CLEAR_BIT_MOCK, CLEAR_BIT_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(GET_BIT_MOCK, GET_BIT_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(SysTick_Config, SysTick_Config_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(__WFI, __WFI_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(__disable_irq, __disable_irq_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(__get_PRIMASK, __get_PRIMASK_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(__set_PRIMASK, __set_PRIMASK_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(HalAdc_StartScan, HalAdc_StartScan_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(HalAdc_StopScan, HalAdc_StopScan_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(HalAdc_EnableWatchdog, HalAdc_EnableWatchdog_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(HalAdc_DisableWatchdog, HalAdc_DisableWatchdog_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(System_RaiseWarning, System_RaiseWarning_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(System_ClearWarning, System_ClearWarning_CustomFake);
+
+    mcu = {};
+    warningLog = {};
+    slowTaskCalls = 0UL;
+    fastTaskCalls = 0UL;
+    return;
+}
+
+static void Sim_RunMainLoop(uint64_t ms)
+{
+    uint64_t endCycles = mcu.cycles + (ms * cyclesPerMs);
+    while (mcu.cycles < endCycles)
+    {
+        Scheduler_Run();
+        Sim_Execute(mainLoopCycles);
+        Scheduler_Idle();
+    }
+    return;
+}
+
+static void Sim_Execute(uint64_t cycles)
+{
+    while (cycles > 0UL)
+    {
+        cycles -= Sim_AdvanceClock(cycles);
+        Sim_TakeInterrupts();
+    }
+    return;
+}
+
+static uint64_t Sim_AdvanceClock(uint64_t cycles)
+{
+    uint64_t step = cycles;
+    if (mcu.isScanning && (mcu.nextSample - mcu.cycles < step))
+    {
+        step = mcu.nextSample - mcu.cycles;
+    }
+    if (mcu.isTickEnabled)
+    {
+        // The counter reloads on the cycle after reaching zero and interrupts when it reaches zero again.
+        if (mcu.value == 0UL)
+        {
+            mcu.value = mcu.load + 1UL;
+        }
+        if (step > mcu.value)
+        {
+            step = mcu.value;
+        }
+        mcu.value -= (uint32_t)step;
+        if (mcu.value == 0UL)
+        {
+            mcu.isTickPending = true;
+        }
+    }
+    mcu.cycles += step;
+    if (mcu.isScanning && (mcu.cycles >= mcu.nextSample))
+    {
+        // The DMA interrupts when the first or the second half of the circular buffer has been filled.
+        mcu.adcResult = Sim_GetAdcResult();
+        mcu.pScanBuffer[mcu.sampleIndex] = mcu.adcResult;
+        if (mcu.isWatchdogArmed &&
+            ((mcu.adcResult < mcu.watchdog.lowThreshold) || (mcu.adcResult > mcu.watchdog.highThreshold)))
+        {
+            mcu.isWatchdogArmed = false;
+            mcu.isAdcPending = true;
+        }
+        ++mcu.sampleIndex;
+        ++mcu.conversions;
+        mcu.nextSample += mcu.samplePeriod;
+        if ((mcu.sampleIndex == mcu.scanLength / 2UL) || (mcu.sampleIndex == mcu.scanLength))
+        {
+            mcu.pBlock = &mcu.pScanBuffer[mcu.sampleIndex - (mcu.scanLength / 2UL)];
+            mcu.isDmaPending = true;
+        }
+        mcu.sampleIndex %= mcu.scanLength;
+    }
+    return step;
+}
+
+static void Sim_TakeInterrupts(void)
+{
+    // Interrupts of the model do not preempt each other, so they are taken in order of priority.
+    if ((mcu.isPrimaskSet == false) && (mcu.isInterruptActive == false))
+    {
+        mcu.isInterruptActive = true;
+        while (mcu.isTickPending || mcu.isDmaPending || mcu.isAdcPending)
+        {
+            if (mcu.isAdcPending)
+            {
+                mcu.isAdcPending = false;
+                mcu.watchdog.Callback(mcu.adcResult);
+            }
+            if (mcu.isDmaPending)
+            {
+                mcu.isDmaPending = false;
+                mcu.BlockCallback(mcu.pBlock, mcu.scanLength / 2UL);
+            }
+            if (mcu.isTickPending)
+            {
+                mcu.isTickPending = false;
+                ++mcu.tickInterrupts;
+                SysTick_Handler();
+            }
+            PendSV_Handler();
+        }
+        mcu.isInterruptActive = false;
+    }
+    return;
+}
+
+static uint64_t Sim_GetMs(void)
+{
+    return mcu.cycles / cyclesPerMs;
+}
+
+static uint16_t Sim_GetAdcResult(void)
+{
+    uint64_t ms = Sim_GetMs();
+    uint64_t voltage = nominalVoltage;
+    if ((ms >= dipStartMs) && (ms < dipStartMs + disturbanceMs))
+    {
+        voltage = dipVoltage;
+    }
+    else if ((ms >= surgeStartMs) && (ms < surgeStartMs + disturbanceMs))
+    {
+        voltage = surgeVoltage;
+    }
+    return (uint16_t)(((voltage * 0xFFFUL) + 1000UL) / 2000UL);
+}
+
+static void Sim_CountingTask(void* pContext)
+{
+    ++(*(uint32_t*)pContext);
+    return;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Custom Fake Definitions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+static uint32_t REG_READ_CustomFake(uint32_t* pRegister)
+{
+    uint32_t value;
+    if (pRegister == &SysTick->VAL)
+    {
+        value = mcu.value;
+    }
+    else if (pRegister == &DWT->CYCCNT)
+    {
+        value = (uint32_t)mcu.cycles;
+    }
+    else
+    {
+        value = *pRegister;
+    }
+    return value;
+}
+
+static void REG_WRITE_CustomFake(uint32_t* pRegister, uint32_t value)
+{
+    if (pRegister == &SysTick->VAL)
+    {
+        // Any write clears the counter.
+        mcu.value = 0UL;
+    }
+    else if (pRegister == &SysTick->LOAD)
+    {
+        mcu.load = value;
+    }
+    else if (pRegister != &SCB->ICSR)
+    {
+        // PendSV requests are not modelled, PendSV_Handler() runs after every interrupt.
+        *pRegister = value;
+    }
+    return;
+}
+
+static void SET_BIT_CustomFake(uint32_t* pRegister, uint32_t bit)
+{
+    if ((pRegister == &SysTick->CTRL) && (bit == SysTick_CTRL_ENABLE_Pos))
+    {
+        mcu.isTickEnabled = true;
+        // The first clock after enabling a cleared counter reloads it before the next instruction.
+        if (mcu.value == 0UL)
+        {
+            mcu.value = mcu.load;
+            ++mcu.cycles;
+        }
+    }
+    else
+    {
+        *pRegister |= (1UL << bit);
+    }
+    return;
+}
+
+static void CLEAR_BIT_CustomFake(uint32_t* pRegister, uint32_t bit)
+{
+    if ((pRegister == &SysTick->CTRL) && (bit == SysTick_CTRL_ENABLE_Pos))
+    {
+        mcu.isTickEnabled = false;
+    }
+    else
+    {
+        *pRegister &= ~(1UL << bit);
+    }
+    return;
+}
+
+static bool GET_BIT_CustomFake(uint32_t* pRegister, uint32_t bit)
+{
+    bool isSet;
+    if ((pRegister == &SCB->ICSR) && (bit == SCB_ICSR_PENDSTSET_Pos))
+    {
+        isSet = mcu.isTickPending;
+    }
+    else
+    {
+        isSet = ((*pRegister & (1UL << bit)) != 0UL);
+    }
+    return isSet;
+}
+
+static uint32_t SysTick_Config_CustomFake(uint32_t ticks)
+{
+    REG_WRITE_CustomFake(&SysTick->LOAD, ticks - 1UL);
+    REG_WRITE_CustomFake(&SysTick->VAL, 0UL);
+    SET_BIT_CustomFake(&SysTick->CTRL, SysTick_CTRL_ENABLE_Pos);
+    return 0UL;
+}
+
+static void __WFI_CustomFake(void)
+{
+    if ((mcu.isTickEnabled || mcu.isScanning) == false)
+    {
+        FAIL ("The CPU sleeps without a wake-up source.");
+    }
+    while ((mcu.isTickPending || mcu.isDmaPending || mcu.isAdcPending) == false)
+    {
+        (void)Sim_AdvanceClock(UINT64_MAX);
+    }
+    return;
+}
+
+static void __disable_irq_CustomFake(void)
+{
+    mcu.isPrimaskSet = true;
+    return;
+}
+
+static uint32_t __get_PRIMASK_CustomFake(void)
+{
+    return mcu.isPrimaskSet ? 1UL : 0UL;
+}
+
+static void __set_PRIMASK_CustomFake(uint32_t priMask)
+{
+    mcu.isPrimaskSet = (priMask != 0UL);
+    Sim_TakeInterrupts();
+    return;
+}
+
+static Error_t HalAdc_StartScan_CustomFake(const AdcScanConfig_t* pConfig)
+{
+    Error_t error = ERROR_RESOURCE_NOT_AVAILABLE;
+    if (mcu.isScanning == false)
+    {
+        mcu.isScanning = true;
+        mcu.samplePeriod = (cyclesPerMs * 1000UL) / pConfig->scanRate;
+        mcu.nextSample = mcu.cycles + mcu.samplePeriod;
+        mcu.pScanBuffer = pConfig->pBuffer;
+        mcu.scanLength = pConfig->bufferLength;
+        mcu.sampleIndex = 0UL;
+        mcu.BlockCallback = pConfig->Callback;
+        error = ERROR_OK;
+    }
+    return error;
+}
+
+static Error_t HalAdc_StopScan_CustomFake(void)
+{
+    Error_t error = ERROR_INVALID_ACTION;
+    if (mcu.isScanning)
+    {
+        mcu.isScanning = false;
+        mcu.isDmaPending = false;
+        error = ERROR_OK;
+    }
+    return error;
+}
+
+static Error_t HalAdc_EnableWatchdog_CustomFake(const AdcWatchdogConfig_t* pConfig)
+{
+    mcu.watchdog = *pConfig;
+    mcu.isWatchdogArmed = true;
+    return ERROR_OK;
+}
+
+static void HalAdc_DisableWatchdog_CustomFake(void)
+{
+    mcu.isWatchdogArmed = false;
+    return;
+}
+
+static void System_RaiseWarning_CustomFake(SystemWarningFlag_t warning)
+{
+    warningLog.raisedMs[warning] = Sim_GetMs();
+    ++warningLog.raises;
+    return;
+}
+
+static void System_ClearWarning_CustomFake(SystemWarningFlag_t warning)
+{
+    warningLog.clearedMs[warning] = Sim_GetMs();
+    ++warningLog.clears;
+    return;
+}
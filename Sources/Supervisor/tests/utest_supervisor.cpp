@@ -36,6 +36,7 @@ DEFINE_FFF_GLOBALS;
 #include "utest_helpers.hpp"
 
 extern "C" {
+#include "coroutine.h"
 #include "supervisor.h"
 }
 
@@ -62,16 +63,35 @@ int main(int argc, char* argv[])
 
 extern "C" {
 
+/// @brief The supervisor task context type of the UUT.
+typedef struct
+{
+    AdcChannel_t channel;
+    uint32_t scanRate;
+    const uint16_t* volatile pBlock;
+    volatile uint32_t blockLength;
+    volatile bool isWatchdogTriggered;
+    volatile uint16_t watchdogSample;
+    bool isWatchdogArmed;
+    Coroutine_t coroutine;
+} SupervisorTask_t;
+
 extern const GpioPin_t alarmPin;
+extern SupervisorTask_t supervisorTask;
+extern uint16_t aSampleBuffer[20];
+extern TaskHandle_t taskHandle;
+extern TaskHandle_t recoveryHandle;
+extern bool isRecoveryPending;
 extern bool isInitialised;
-extern uint8_t samples;
-extern uint16_t sampleSum;
 extern uint16_t voltage;
 extern bool uvIsActive;
 extern bool ovIsActive;
 
-extern void Supervisor_AdcCallback(uint16_t result);
-extern void Supervisor_Task(void);
+extern void Supervisor_AdcCallback(const uint16_t* pSamples, uint32_t sampleCount);
+extern void Supervisor_WatchdogCallback(uint16_t result);
+extern void Supervisor_ProcessSamples(const uint16_t* pSamples, uint32_t sampleCount);
+extern void Supervisor_Task(void* pContext);
+extern void Supervisor_RecoveryTask(void* pContext);
 extern uint16_t Supervisor_AdcToVoltage(uint16_t adc);
 
 }
@@ -80,27 +100,47 @@ extern uint16_t Supervisor_AdcToVoltage(uint16_t adc);
 // Test Variables
 //-----------------------------------------------------------------------------------------------------------------------------
 
-static AdcConfig_t adcConfig;
+static AdcScanConfig_t scanConfig;
+static AdcChannel_t scanChannel;
+static AdcWatchdogConfig_t watchdogConfig;
 static GpioConfig_t gpioConfig;
+static TaskConfig_t oneShotConfigs[2];
+static TaskHandle_t createdOneShotHandles[2];
+static uint32_t createdOneShots;
 
 //-----------------------------------------------------------------------------------------------------------------------------
 // Custom Fake Prototypes
 //-----------------------------------------------------------------------------------------------------------------------------
 
-/// @brief A custom fake for HalAdc_SetConfiguration().
-static void HalAdc_SetConfiguration_CustomFake(const AdcConfig_t* pConfig);
+/// @brief A custom fake for HalAdc_StartScan().
+static Error_t HalAdc_StartScan_CustomFake(const AdcScanConfig_t* pConfig);
+
+/// @brief A custom fake for HalAdc_EnableWatchdog().
+static Error_t HalAdc_EnableWatchdog_CustomFake(const AdcWatchdogConfig_t* pConfig);
 
 /// @brief A custom fake for HalGpio_SetConfiguration().
 static void HalGpio_SetConfiguration_CustomFake(const GpioConfig_t* pConfig);
 
+/// @brief A custom fake for Scheduler_CreateOneShot().
+static Error_t Scheduler_CreateOneShot_CustomFake(const TaskConfig_t* pConfig, TaskHandle_t* pHandle);
+
 //-----------------------------------------------------------------------------------------------------------------------------
 // Helper Functions
 //-----------------------------------------------------------------------------------------------------------------------------
 
-/// @brief This helper function sets the supervision voltage to a given value by calling Supervisor_AdcCallback() repeatedly.
+/// @brief This helper function sets the supervision voltage to a given value by processing a block of samples.
 /// @param voltage - An voltage value to set in 0.01 resolution.
 static void Helper_SetVoltage(uint32_t voltage);
 
+/// @brief This helper function fills a block with the ADC result of a given voltage.
+/// @param pBlock - A pointer to the block of 10 samples.
+/// @param voltage - An voltage value in 0.01 resolution.
+static void Helper_FillBlock(uint16_t* pBlock, uint32_t voltage);
+
+/// @brief This helper function runs the supervisor task from the start of its sequence into the wait for the warnings
+/// to clear. The scan shall already run at the fast rate.
+static void Helper_WaitForRecovery(void);
+
 //-----------------------------------------------------------------------------------------------------------------------------
 // Test Cases
 //-----------------------------------------------------------------------------------------------------------------------------
@@ -111,7 +151,6 @@ SCENARIO ("Supervisor module is initialised", "[supervisor]")
     ADC_MOCK_RESET();
     GPIO_MOCK_RESET();
     
-    MOCK_SET_CUSTOM_FAKE(HalAdc_SetConfiguration, HalAdc_SetConfiguration_CustomFake);
     MOCK_SET_CUSTOM_FAKE(HalGpio_SetConfiguration, HalGpio_SetConfiguration_CustomFake);
 
     GIVEN ("the module is not initialised")
@@ -126,26 +165,21 @@ SCENARIO ("Supervisor module is initialised", "[supervisor]")
             {
                 REQUIRE (isInitialised == true);
 
-                AND_THEN ("the ADC shall be configured")
+                AND_THEN ("the alarm GPIO shall be configured")
                 {
-                    REQUIRE (MOCK_NEXT_CALLED_FUNCTION_IS(HalAdc_SetConfiguration));
-                    REQUIRE (MOCK_CALLS(HalAdc_SetConfiguration) == 1);
+                    REQUIRE (MOCK_NEXT_CALLED_FUNCTION_IS(HalGpio_SetConfiguration));
+                    REQUIRE (MOCK_CALLS(HalGpio_SetConfiguration) == 1);
 
-                    REQUIRE (adcConfig.channel == ADC1);
-                    REQUIRE (adcConfig.resolution == ADC_RES_12_BIT);
-                    REQUIRE (adcConfig.Callback == Supervisor_AdcCallback);
+                    REQUIRE (gpioConfig.pin.port == portC);
+                    REQUIRE (gpioConfig.pin.number == 5U);
+                    REQUIRE (gpioConfig.mode == output);
+                    REQUIRE (gpioConfig.isOpenDrain == true);
+                    REQUIRE (gpioConfig.speed == low);
+                    REQUIRE (gpioConfig.pull == floating);
 
-                    AND_THEN ("the alarm GPIO shall be configured")
+                    AND_THEN ("the ADC shall not be started before the supervision")
                     {
-                        REQUIRE (MOCK_NEXT_CALLED_FUNCTION_IS(HalGpio_SetConfiguration));
-                        REQUIRE (MOCK_CALLS(HalGpio_SetConfiguration) == 1);
-
-                        REQUIRE (gpioConfig.pin.port == portC);
-                        REQUIRE (gpioConfig.pin.number == 5U);
-                        REQUIRE (gpioConfig.mode == output);
-                        REQUIRE (gpioConfig.isOpenDrain == true);
-                        REQUIRE (gpioConfig.speed == low);
-                        REQUIRE (gpioConfig.pull == floating);
+                        REQUIRE (MOCK_CALLS(HalAdc_StartScan) == 0);
                     }
                 }
             }
@@ -156,14 +190,26 @@ SCENARIO ("Supervisor module is initialised", "[supervisor]")
 SCENARIO ("Supervision is started", "[supervisor]")
 {
     INIT_MOCKS();
+    ADC_MOCK_RESET();
     SCHEDULER_MOCK_RESET();
 
+    MOCK_SET_CUSTOM_FAKE(Scheduler_CreateOneShot, Scheduler_CreateOneShot_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(HalAdc_StartScan, HalAdc_StartScan_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(HalAdc_EnableWatchdog, HalAdc_EnableWatchdog_CustomFake);
+
     GIVEN ("the module is initialised and there are some random measurement data")
     {
         isInitialised = true;
-        samples = 123U;
-        sampleSum = 123U;
+        taskHandle = 0UL;
+        recoveryHandle = 0UL;
+        isRecoveryPending = true;
+        createdOneShots = 0UL;
+        createdOneShotHandles[0] = (TaskHandle_t)UTestHelper::GetRandomInt(1, 100000);
+        createdOneShotHandles[1] = (TaskHandle_t)UTestHelper::GetRandomInt(1, 100000);
         voltage = 123U;
+        supervisorTask.pBlock = aSampleBuffer;
+        uvIsActive = false;
+        ovIsActive = false;
 
         WHEN ("the supervision is started")
         {
@@ -173,18 +219,54 @@ SCENARIO ("Supervision is started", "[supervisor]")
             {
                 REQUIRE (error == ERROR_OK);
 
-                AND_THEN ("the supervision task shall be created")
+                AND_THEN ("the recovery timer shall be created stopped")
+                {
+                    REQUIRE (MOCK_CALLS(Scheduler_CreateOneShot) == 2);
+                    REQUIRE (oneShotConfigs[0].Task == Supervisor_RecoveryTask);
+                    REQUIRE (oneShotConfigs[0].phase == 0U);
+                    REQUIRE (MOCK_IS_CALLED_AT_POSITION(Scheduler_CreateOneShot, 0));
+                    REQUIRE (recoveryHandle == createdOneShotHandles[0]);
+                    REQUIRE (isRecoveryPending == false);
+                }
+
+                AND_THEN ("the supervision task shall be created to wait for the ADC")
                 {
-                    REQUIRE (MOCK_CALLS(Scheduler_CreateTask) == 1);
-                    REQUIRE (MOCK_LAST_ARG(Scheduler_CreateTask, 0) == Supervisor_Task);
-                    REQUIRE (MOCK_LAST_ARG(Scheduler_CreateTask, 1) == 100);
-                    REQUIRE (MOCK_IS_CALLED_AT_POSITION(Scheduler_CreateTask, 0));
+                    REQUIRE (oneShotConfigs[1].Task == Supervisor_Task);
+                    REQUIRE (oneShotConfigs[1].pContext == &supervisorTask);
+                    REQUIRE (oneShotConfigs[1].phase == 0U);
+                    REQUIRE (taskHandle == createdOneShotHandles[1]);
 
-                    AND_THEN ("the measurement data shall be reset")
+                    AND_THEN ("the supervised channel shall be scanned into two blocks of 10 samples at 10 Hz")
                     {
-                        REQUIRE (samples == 0U);
-                        REQUIRE (sampleSum == 0U);
-                        REQUIRE (voltage == 0U);
+                        REQUIRE (MOCK_CALLS(HalAdc_StartScan) == 1);
+                        REQUIRE (MOCK_IS_CALLED_AT_POSITION(HalAdc_StartScan, 2));
+                        REQUIRE (scanChannel == ADC_CHANNEL_1);
+                        REQUIRE (scanConfig.channelCount == 1UL);
+                        REQUIRE (scanConfig.resolution == ADC_RES_12_BIT);
+                        REQUIRE (scanConfig.sampleTime == ADC_SAMPLE_TIME_84_CYCLES);
+                        REQUIRE (scanConfig.pBuffer == aSampleBuffer);
+                        REQUIRE (scanConfig.bufferLength == 20UL);
+                        REQUIRE (scanConfig.Callback == Supervisor_AdcCallback);
+                        REQUIRE (scanConfig.trigger == ADC_TRIGGER_TIM2_TRGO);
+                        REQUIRE (scanConfig.scanRate == 10UL);
+
+                        AND_THEN ("the watchdog shall guard the channel against the warning limits")
+                        {
+                            REQUIRE (MOCK_CALLS(HalAdc_EnableWatchdog) == 1);
+                            REQUIRE (MOCK_IS_CALLED_AT_POSITION(HalAdc_EnableWatchdog, 3));
+                            REQUIRE (watchdogConfig.channel == ADC_CHANNEL_1);
+                            REQUIRE (watchdogConfig.lowThreshold == 2149U);
+                            REQUIRE (watchdogConfig.highThreshold == 2765U);
+                            REQUIRE (watchdogConfig.Callback == Supervisor_WatchdogCallback);
+                            REQUIRE (supervisorTask.isWatchdogArmed == true);
+
+                            AND_THEN ("the measurement data shall be reset")
+                            {
+                                REQUIRE (voltage == 0U);
+                                REQUIRE (supervisorTask.pBlock == nullptr);
+                                REQUIRE (supervisorTask.isWatchdogTriggered == false);
+                            }
+                        }
                     }
                 }
             }
@@ -195,15 +277,42 @@ SCENARIO ("Supervision is started", "[supervisor]")
 SCENARIO ("Supervision start fails", "[supervisor][error_handling]")
 {
     INIT_MOCKS();
+    ADC_MOCK_RESET();
     SCHEDULER_MOCK_RESET();
 
     GIVEN ("the module is initialised")
     {
         isInitialised = true;
+        createdOneShots = 0UL;
+        createdOneShotHandles[0] = (TaskHandle_t)UTestHelper::GetRandomInt(1, 100000);
+        createdOneShotHandles[1] = (TaskHandle_t)UTestHelper::GetRandomInt(1, 100000);
+
+        AND_GIVEN ("the recovery timer cannot be created")
+        {
+            MOCK_SET_RETURN_VALUE(Scheduler_CreateOneShot, ERROR_NOT_ENOUGH_RESOURCES);
+
+            WHEN ("the supervision is started")
+            {
+                Error_t error = Supervisor_Start();
+
+                THEN ("the error shall propagate")
+                {
+                    REQUIRE (error == ERROR_NOT_ENOUGH_RESOURCES);
+
+                    AND_THEN ("the supervision task shall not be created")
+                    {
+                        REQUIRE (MOCK_CALLS(Scheduler_CreateOneShot) == 1);
+                        REQUIRE (MOCK_CALLS(HalAdc_StartScan) == 0);
+                    }
+                }
+            }
+        }
 
-        AND_GIVEN ("Scheduler_CreateTask() fails")
+        AND_GIVEN ("the supervision task cannot be created")
         {
-            MOCK_SET_RETURN_VALUE(Scheduler_CreateTask, ERROR_NOT_ENOUGH_RESOURCES);
+            Error_t aReturnValues[] = {ERROR_OK, ERROR_NOT_ENOUGH_RESOURCES};
+            MOCK_SET_RETURN_VALUE_SEQUENCE(Scheduler_CreateOneShot, aReturnValues, 2);
+            recoveryHandle = createdOneShotHandles[0];
 
             WHEN ("the supervision is started")
             {
@@ -212,6 +321,60 @@ SCENARIO ("Supervision start fails", "[supervisor][error_handling]")
                 THEN ("the error shall propagate")
                 {
                     REQUIRE (error == ERROR_NOT_ENOUGH_RESOURCES);
+
+                    AND_THEN ("the recovery timer shall be deleted")
+                    {
+                        REQUIRE (MOCK_CALLS(Scheduler_DeleteTask) == 1);
+                        REQUIRE (MOCK_LAST_ARG(Scheduler_DeleteTask, 0) == recoveryHandle);
+                        REQUIRE (MOCK_CALLS(HalAdc_StartScan) == 0);
+                    }
+                }
+            }
+        }
+
+        AND_GIVEN ("the ADC scan cannot be started")
+        {
+            MOCK_SET_CUSTOM_FAKE(Scheduler_CreateOneShot, Scheduler_CreateOneShot_CustomFake);
+            MOCK_SET_RETURN_VALUE(HalAdc_StartScan, ERROR_RESOURCE_NOT_AVAILABLE);
+
+            WHEN ("the supervision is started")
+            {
+                Error_t error = Supervisor_Start();
+
+                THEN ("the error shall propagate")
+                {
+                    REQUIRE (error == ERROR_RESOURCE_NOT_AVAILABLE);
+
+                    AND_THEN ("the supervision task and the recovery timer shall be deleted")
+                    {
+                        REQUIRE (MOCK_CALLS(Scheduler_DeleteTask) == 2);
+                        REQUIRE (MOCK_ARG_HISTORY(Scheduler_DeleteTask, 0, 0) == createdOneShotHandles[1]);
+                        REQUIRE (MOCK_ARG_HISTORY(Scheduler_DeleteTask, 0, 1) == createdOneShotHandles[0]);
+                        REQUIRE (MOCK_CALLS(HalAdc_EnableWatchdog) == 0);
+                    }
+                }
+            }
+        }
+
+        AND_GIVEN ("the watchdog cannot be armed")
+        {
+            MOCK_SET_CUSTOM_FAKE(Scheduler_CreateOneShot, Scheduler_CreateOneShot_CustomFake);
+            MOCK_SET_RETURN_VALUE(HalAdc_EnableWatchdog, ERROR_INVALID_ACTION);
+
+            WHEN ("the supervision is started")
+            {
+                Error_t error = Supervisor_Start();
+
+                THEN ("the error shall propagate")
+                {
+                    REQUIRE (error == ERROR_INVALID_ACTION);
+                    REQUIRE (supervisorTask.isWatchdogArmed == false);
+
+                    AND_THEN ("the scan shall be stopped and the tasks shall be deleted")
+                    {
+                        REQUIRE (MOCK_CALLS(HalAdc_StopScan) == 1);
+                        REQUIRE (MOCK_CALLS(Scheduler_DeleteTask) == 2);
+                    }
                 }
             }
         }
@@ -236,13 +399,17 @@ SCENARIO ("Supervision start fails", "[supervisor][error_handling]")
 SCENARIO ("Supervision is stopped", "[supervisor]")
 {
     INIT_MOCKS();
+    ADC_MOCK_RESET();
     SCHEDULER_MOCK_RESET();
 
     GIVEN ("the module is initialised and some random measurement data")
     {
         isInitialised = true;
-        samples = 123U;
-        sampleSum = 123U;
+        taskHandle = (TaskHandle_t)UTestHelper::GetRandomInt(1, 100000);
+        recoveryHandle = (TaskHandle_t)UTestHelper::GetRandomInt(1, 100000);
+        isRecoveryPending = true;
+        supervisorTask.pBlock = aSampleBuffer;
+        supervisorTask.isWatchdogArmed = true;
         voltage = 123U;
 
         WHEN ("the supervision is stopped")
@@ -253,17 +420,27 @@ SCENARIO ("Supervision is stopped", "[supervisor]")
             {
                 REQUIRE (error == ERROR_OK);
 
-                AND_THEN ("the supervision task shall be deleted")
+                AND_THEN ("the watchdog and the ADC scan shall be stopped")
                 {
-                    REQUIRE (MOCK_CALLS(Scheduler_DeleteTask) == 1);
-                    REQUIRE (MOCK_LAST_ARG(Scheduler_DeleteTask, 0) == Supervisor_Task);
-                    REQUIRE (MOCK_IS_CALLED_AT_POSITION(Scheduler_DeleteTask, 0));
+                    REQUIRE (MOCK_CALLS(HalAdc_DisableWatchdog) == 1);
+                    REQUIRE (MOCK_IS_CALLED_AT_POSITION(HalAdc_DisableWatchdog, 0));
+                    REQUIRE (supervisorTask.isWatchdogArmed == false);
+                    REQUIRE (MOCK_CALLS(HalAdc_StopScan) == 1);
+                    REQUIRE (MOCK_IS_CALLED_AT_POSITION(HalAdc_StopScan, 1));
 
-                    AND_THEN ("the measurement data shall be reset")
+                    AND_THEN ("the supervision task and the recovery timer shall be deleted")
                     {
-                        REQUIRE (samples == 0U);
-                        REQUIRE (sampleSum == 0U);
-                        REQUIRE (voltage == 0U);
+                        REQUIRE (MOCK_CALLS(Scheduler_DeleteTask) == 2);
+                        REQUIRE (MOCK_ARG_HISTORY(Scheduler_DeleteTask, 0, 0) == taskHandle);
+                        REQUIRE (MOCK_ARG_HISTORY(Scheduler_DeleteTask, 0, 1) == recoveryHandle);
+                        REQUIRE (MOCK_IS_CALLED_AT_POSITION(Scheduler_DeleteTask, 2));
+                        REQUIRE (isRecoveryPending == false);
+
+                        AND_THEN ("the measurement data shall be reset")
+                        {
+                            REQUIRE (supervisorTask.pBlock == nullptr);
+                            REQUIRE (voltage == 0U);
+                        }
                     }
                 }
             }
@@ -274,12 +451,29 @@ SCENARIO ("Supervision is stopped", "[supervisor]")
 SCENARIO ("Supervision stop fails", "[supervisor][error_handling]")
 {
     INIT_MOCKS();
+    ADC_MOCK_RESET();
     SCHEDULER_MOCK_RESET();
 
     GIVEN ("the module is initialised")
     {
         isInitialised = true;
 
+        AND_GIVEN ("HalAdc_StopScan() fails")
+        {
+            MOCK_SET_RETURN_VALUE(HalAdc_StopScan, ERROR_INVALID_ACTION);
+
+            WHEN ("the supervision is stopped")
+            {
+                Error_t error = Supervisor_Stop();
+
+                THEN ("the error shall propagate and the tasks shall be deleted anyway")
+                {
+                    REQUIRE (error == ERROR_INVALID_ACTION);
+                    REQUIRE (MOCK_CALLS(Scheduler_DeleteTask) == 2);
+                }
+            }
+        }
+
         AND_GIVEN ("Scheduler_DeleteTask() fails")
         {
             MOCK_SET_RETURN_VALUE(Scheduler_DeleteTask, ERROR_INVALID_ACTION);
@@ -294,6 +488,23 @@ SCENARIO ("Supervision stop fails", "[supervisor][error_handling]")
                 }
             }
         }
+
+        AND_GIVEN ("the recovery timer deletion fails")
+        {
+            Error_t aReturnValues[] = {ERROR_OK, ERROR_INVALID_ACTION};
+            MOCK_SET_RETURN_VALUE_SEQUENCE(Scheduler_DeleteTask, aReturnValues, 2);
+
+            WHEN ("the supervision is stopped")
+            {
+                Error_t error = Supervisor_Stop();
+
+                THEN ("the error shall propagate")
+                {
+                    REQUIRE (error == ERROR_INVALID_ACTION);
+                    REQUIRE (MOCK_CALLS(Scheduler_DeleteTask) == 2);
+                }
+            }
+        }
     }
 
     GIVEN ("the module is not initialised")
@@ -334,49 +545,321 @@ SCENARIO ("Supervision task is called", "[supervisor]")
 {
     INIT_MOCKS();
     ADC_MOCK_RESET();
+    SCHEDULER_MOCK_RESET();
     SYSTEM_MOCK_RESET();
 
-    GIVEN ("no prerequisites")
+    GIVEN ("the supervision has been started")
     {
-        WHEN ("the supervision task is called")
+        taskHandle = (TaskHandle_t)UTestHelper::GetRandomInt(1, 100000);
+        supervisorTask.scanRate = 10UL;
+        supervisorTask.pBlock = NULL;
+        supervisorTask.isWatchdogTriggered = false;
+        supervisorTask.isWatchdogArmed = true;
+        COROUTINE_RESET(&supervisorTask.coroutine);
+        voltage = 0U;
+        uvIsActive = false;
+        ovIsActive = false;
+        isRecoveryPending = false;
+
+        WHEN ("the supervision task is called before an ADC block")
+        {
+            Supervisor_Task(&supervisorTask);
+
+            THEN ("nothing shall be processed")
+            {
+                REQUIRE (voltage == 0U);
+                REQUIRE (MOCK_CALLS(HalAdc_StopScan) == 0);
+                REQUIRE (MOCK_CALLS(HalAdc_EnableWatchdog) == 0);
+                REQUIRE (MOCK_CALLS(System_RaiseError) == 0);
+            }
+        }
+
+        WHEN ("the task is resumed by an ADC block")
         {
-            Supervisor_Task();
+            Helper_FillBlock(&aSampleBuffer[10], 1200U);
+            Supervisor_AdcCallback(&aSampleBuffer[10], 10UL);
+            Supervisor_Task(&supervisorTask);
 
-            THEN ("the ADC conversion shall be started")
+            THEN ("the block shall be averaged in task context")
             {
-                REQUIRE (MOCK_CALLS(HalAdc_StartConversion) == 1);
-                REQUIRE (MOCK_LAST_ARG(HalAdc_StartConversion, 0) == ADC1);
-                REQUIRE (MOCK_IS_CALLED_AT_POSITION(HalAdc_StartConversion, 0));
+                REQUIRE (voltage == 1200U);
+                REQUIRE (supervisorTask.pBlock == nullptr);
 
-                AND_THEN ("supervisor failure shall not be raised")
+                AND_THEN ("the scan shall keep running at the normal rate")
                 {
+                    REQUIRE (MOCK_CALLS(HalAdc_StopScan) == 0);
+                    REQUIRE (MOCK_CALLS(HalAdc_StartScan) == 0);
                     REQUIRE (MOCK_CALLS(System_RaiseError) == 0);
+
+                    AND_WHEN ("the task is called again before the next block")
+                    {
+                        voltage = 0U;
+                        Supervisor_Task(&supervisorTask);
+
+                        THEN ("the block shall not be processed twice")
+                        {
+                            REQUIRE (voltage == 0U);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("Supervision task is resumed by the watchdog", "[supervisor]")
+{
+    INIT_MOCKS();
+    ADC_MOCK_RESET();
+    SCHEDULER_MOCK_RESET();
+    SYSTEM_MOCK_RESET();
+    GPIO_MOCK_RESET();
+
+    MOCK_SET_CUSTOM_FAKE(HalAdc_StartScan, HalAdc_StartScan_CustomFake);
+
+    GIVEN ("the watchdog is armed and the voltage is nominal")
+    {
+        taskHandle = (TaskHandle_t)UTestHelper::GetRandomInt(1, 100000);
+        supervisorTask.scanRate = 10UL;
+        supervisorTask.pBlock = NULL;
+        supervisorTask.isWatchdogTriggered = false;
+        supervisorTask.isWatchdogArmed = true;
+        COROUTINE_RESET(&supervisorTask.coroutine);
+        voltage = 1200U;
+        uvIsActive = false;
+        ovIsActive = false;
+        isRecoveryPending = false;
+
+        WHEN ("a sample below the undervoltage limit is converted")
+        {
+            Supervisor_WatchdogCallback(2148U);
+
+            THEN ("the task shall be resumed without processing the sample in the interrupt")
+            {
+                REQUIRE (MOCK_CALLS(Scheduler_ResumeTask) == 1);
+                REQUIRE (MOCK_LAST_ARG(Scheduler_ResumeTask, 0) == taskHandle);
+                REQUIRE (voltage == 1200U);
+
+                AND_WHEN ("the task is called")
+                {
+                    Supervisor_Task(&supervisorTask);
+
+                    THEN ("the undervoltage shall be raised at once from the single sample")
+                    {
+                        REQUIRE (voltage == 1049U);
+                        REQUIRE (uvIsActive == true);
+                        REQUIRE (MOCK_CALLS(System_RaiseWarning) == 1);
+                        REQUIRE (MOCK_LAST_ARG(System_RaiseWarning, 0) == UNDERVOLTAGE_WARNING);
+
+                        AND_THEN ("the scan shall be restarted fast and the watchdog shall stay disarmed")
+                        {
+                            REQUIRE (scanConfig.scanRate == 100UL);
+                            REQUIRE (MOCK_CALLS(HalAdc_EnableWatchdog) == 0);
+                            REQUIRE (supervisorTask.isWatchdogArmed == false);
+                            REQUIRE (supervisorTask.isWatchdogTriggered == false);
+                            REQUIRE (MOCK_CALLS(System_RaiseError) == 0);
+                        }
+                    }
                 }
             }
         }
+
+        WHEN ("a sample above the overvoltage limit is converted and the task is called")
+        {
+            Supervisor_WatchdogCallback(2766U);
+            Supervisor_Task(&supervisorTask);
+
+            THEN ("the overvoltage shall be raised at once from the single sample")
+            {
+                REQUIRE (voltage == 1351U);
+                REQUIRE (ovIsActive == true);
+                REQUIRE (MOCK_LAST_ARG(System_RaiseWarning, 0) == OVERVOLTAGE_WARNING);
+            }
+        }
     }
+    uvIsActive = false;
+    ovIsActive = false;
+    supervisorTask.scanRate = 10UL;
+}
+
+SCENARIO ("Supervision samples fast while a warning is active", "[supervisor]")
+{
+    INIT_MOCKS();
+    ADC_MOCK_RESET();
+    SCHEDULER_MOCK_RESET();
+    SYSTEM_MOCK_RESET();
+    GPIO_MOCK_RESET();
+
+    MOCK_SET_CUSTOM_FAKE(HalAdc_StartScan, HalAdc_StartScan_CustomFake);
+
+    GIVEN ("the scan runs at the normal rate without warnings")
+    {
+        supervisorTask.scanRate = 10UL;
+        supervisorTask.pBlock = NULL;
+        supervisorTask.isWatchdogTriggered = false;
+        supervisorTask.isWatchdogArmed = true;
+        COROUTINE_RESET(&supervisorTask.coroutine);
+        uvIsActive = false;
+        ovIsActive = false;
+        isRecoveryPending = false;
+
+        WHEN ("a block of undervoltage is processed")
+        {
+            Helper_FillBlock(aSampleBuffer, 1000U);
+            Supervisor_AdcCallback(aSampleBuffer, 10UL);
+            Supervisor_Task(&supervisorTask);
+
+            THEN ("the scan shall be restarted at 100 Hz")
+            {
+                REQUIRE (uvIsActive == true);
+                REQUIRE (MOCK_CALLS(HalAdc_StopScan) == 1);
+                REQUIRE (MOCK_CALLS(HalAdc_StartScan) == 1);
+                REQUIRE (scanConfig.scanRate == 100UL);
+                REQUIRE (scanChannel == ADC_CHANNEL_1);
+                REQUIRE (supervisorTask.scanRate == 100UL);
+                REQUIRE (MOCK_CALLS(HalAdc_EnableWatchdog) == 0);
+                REQUIRE (MOCK_CALLS(System_RaiseError) == 0);
+            }
+        }
+    }
+
+    GIVEN ("the scan runs fast while the undervoltage is active")
+    {
+        supervisorTask.scanRate = 100UL;
+        supervisorTask.pBlock = NULL;
+        supervisorTask.isWatchdogTriggered = false;
+        supervisorTask.isWatchdogArmed = false;
+        uvIsActive = true;
+        ovIsActive = false;
+        isRecoveryPending = false;
+        Helper_WaitForRecovery();
+
+        WHEN ("another block of undervoltage is processed")
+        {
+            Helper_FillBlock(aSampleBuffer, 1000U);
+            Supervisor_AdcCallback(aSampleBuffer, 10UL);
+            Supervisor_Task(&supervisorTask);
+
+            THEN ("the task shall keep waiting for the warning to clear")
+            {
+                REQUIRE (voltage == 1000U);
+                REQUIRE (MOCK_CALLS(HalAdc_StopScan) == 0);
+                REQUIRE (MOCK_CALLS(HalAdc_StartScan) == 0);
+                REQUIRE (MOCK_CALLS(HalAdc_EnableWatchdog) == 0);
+                REQUIRE (supervisorTask.scanRate == 100UL);
+                REQUIRE (MOCK_CALLS(System_RaiseError) == 0);
+            }
+        }
+    }
+
+    GIVEN ("the scan runs fast and the warning has been cleared by the recovery timer")
+    {
+        supervisorTask.scanRate = 100UL;
+        supervisorTask.pBlock = NULL;
+        supervisorTask.isWatchdogTriggered = false;
+        supervisorTask.isWatchdogArmed = false;
+        uvIsActive = false;
+        ovIsActive = false;
+        isRecoveryPending = false;
+        Helper_WaitForRecovery();
+
+        WHEN ("the next block is processed")
+        {
+            Helper_FillBlock(aSampleBuffer, 1200U);
+            Supervisor_AdcCallback(aSampleBuffer, 10UL);
+            Supervisor_Task(&supervisorTask);
+
+            THEN ("the scan shall be restarted at the normal rate")
+            {
+                REQUIRE (MOCK_CALLS(HalAdc_StopScan) == 1);
+                REQUIRE (MOCK_CALLS(HalAdc_StartScan) == 1);
+                REQUIRE (scanConfig.scanRate == 10UL);
+                REQUIRE (MOCK_CALLS(System_RaiseError) == 0);
+
+                AND_THEN ("the watchdog shall be armed again")
+                {
+                    REQUIRE (MOCK_CALLS(HalAdc_EnableWatchdog) == 1);
+                    REQUIRE (supervisorTask.isWatchdogArmed == true);
+                }
+            }
+        }
+    }
+    uvIsActive = false;
+    supervisorTask.scanRate = 10UL;
 }
 
 SCENARIO ("Supervision task fails", "[supervisor][error_handling]")
 {
     INIT_MOCKS();
+    ADC_MOCK_RESET();
+    SCHEDULER_MOCK_RESET();
     SYSTEM_MOCK_RESET();
+    GPIO_MOCK_RESET();
 
-    GIVEN ("HalAdc_StartConversion() fails")
+    GIVEN ("the scan runs fast and the warning has been cleared by the recovery timer")
     {
-        MOCK_SET_RETURN_VALUE(HalAdc_StartConversion, ERROR_PERIPHERAL_FAILURE)
+        supervisorTask.scanRate = 100UL;
+        supervisorTask.pBlock = NULL;
+        supervisorTask.isWatchdogTriggered = false;
+        supervisorTask.isWatchdogArmed = false;
+        uvIsActive = false;
+        ovIsActive = false;
+        isRecoveryPending = false;
+        Helper_WaitForRecovery();
+
+        AND_GIVEN ("the watchdog cannot be armed again")
+        {
+            MOCK_SET_RETURN_VALUE(HalAdc_EnableWatchdog, ERROR_INVALID_ACTION);
+
+            WHEN ("the next block is processed")
+            {
+                Helper_FillBlock(aSampleBuffer, 1200U);
+                Supervisor_AdcCallback(aSampleBuffer, 10UL);
+                Supervisor_Task(&supervisorTask);
 
-        WHEN ("the supervision task is called")
+                THEN ("supervisor failure shall be raised")
+                {
+                    REQUIRE (MOCK_CALLS(HalAdc_EnableWatchdog) == 1);
+                    REQUIRE (supervisorTask.isWatchdogArmed == false);
+                    REQUIRE (MOCK_CALLS(System_RaiseError) == 1);
+                    REQUIRE (MOCK_LAST_ARG(System_RaiseError, 0) == SUPERVISOR_FAILURE);
+                }
+            }
+        }
+    }
+
+    GIVEN ("the scan runs at the normal rate without warnings")
+    {
+        supervisorTask.scanRate = 10UL;
+        supervisorTask.pBlock = NULL;
+        supervisorTask.isWatchdogTriggered = false;
+        uvIsActive = false;
+        ovIsActive = false;
+        isRecoveryPending = false;
+        COROUTINE_RESET(&supervisorTask.coroutine);
+
+        AND_GIVEN ("the scan cannot be restarted")
         {
-            Supervisor_Task();
+            supervisorTask.isWatchdogArmed = true;
+            MOCK_SET_RETURN_VALUE(HalAdc_StartScan, ERROR_RESOURCE_NOT_AVAILABLE);
 
-            THEN ("supervisor failure shall be raised")
+            WHEN ("a block of undervoltage is processed")
             {
-                REQUIRE (MOCK_CALLS(System_RaiseError) == 1);
-                REQUIRE (MOCK_LAST_ARG(System_RaiseError, 0) == SUPERVISOR_FAILURE);
+                Helper_FillBlock(aSampleBuffer, 1000U);
+                Supervisor_AdcCallback(aSampleBuffer, 10UL);
+                Supervisor_Task(&supervisorTask);
+
+                THEN ("supervisor failure shall be raised")
+                {
+                    REQUIRE (MOCK_CALLS(HalAdc_StopScan) == 1);
+                    REQUIRE (MOCK_CALLS(System_RaiseError) == 1);
+                    REQUIRE (MOCK_LAST_ARG(System_RaiseError, 0) == SUPERVISOR_FAILURE);
+                }
             }
         }
     }
+    uvIsActive = false;
+    supervisorTask.scanRate = 10UL;
 }
 
 SCENARIO ("ADC value is converted into voltage", "[supervisor]")
@@ -402,15 +885,118 @@ SCENARIO ("ADC value is converted into voltage", "[supervisor]")
                 REQUIRE (result == 1003U);
             }
         }
+
+        WHEN ("the ADC values around the watchdog thresholds are converted into voltage")
+        {
+            THEN ("only the values outside the window shall be outside the warning limits")
+            {
+                REQUIRE (Supervisor_AdcToVoltage(2148U) == 1049U);
+                REQUIRE (Supervisor_AdcToVoltage(2149U) == 1050U);
+                REQUIRE (Supervisor_AdcToVoltage(2765U) == 1350U);
+                REQUIRE (Supervisor_AdcToVoltage(2766U) == 1351U);
+            }
+        }
+
+        WHEN ("all ADC values are converted into voltage with the nominal calibration")
+        {
+            uint32_t mismatches = 0UL;
+            for (uint32_t adc = 0UL; adc <= 0xFFFUL; ++adc)
+            {
+                if (Supervisor_AdcToVoltage((uint16_t)adc) != (uint16_t)(((adc * 2000UL) + (0xFFFUL / 2UL)) / 0xFFFUL))
+                {
+                    ++mismatches;
+                }
+            }
+
+            THEN ("the interpolated voltages shall equal the rounded ideal voltages")
+            {
+                REQUIRE (mismatches == 0UL);
+                REQUIRE (Supervisor_AdcToVoltage(0xFFFFU) == 2000U);
+            }
+        }
+    }
+}
+
+SCENARIO ("ADC block resumes the supervision task", "[supervisor]")
+{
+    INIT_MOCKS();
+    SCHEDULER_MOCK_RESET();
+    SYSTEM_MOCK_RESET();
+
+    GIVEN ("the supervision task is waiting for an ADC block")
+    {
+        isInitialised = true;
+        taskHandle = (TaskHandle_t)UTestHelper::GetRandomInt(1, 100000);
+        supervisorTask.pBlock = NULL;
+        voltage = 0U;
+
+        WHEN ("the ADC callback is called with a block")
+        {
+            Helper_FillBlock(aSampleBuffer, 1200U);
+            Supervisor_AdcCallback(aSampleBuffer, 10UL);
+
+            THEN ("the block shall be handed to the task")
+            {
+                REQUIRE (supervisorTask.pBlock == aSampleBuffer);
+                REQUIRE (supervisorTask.blockLength == 10UL);
+
+                AND_THEN ("the task shall be resumed")
+                {
+                    REQUIRE (MOCK_CALLS(Scheduler_ResumeTask) == 1);
+                    REQUIRE (MOCK_LAST_ARG(Scheduler_ResumeTask, 0) == taskHandle);
+                    REQUIRE (MOCK_CALLS(System_RaiseError) == 0);
+
+                    AND_THEN ("the block shall not be processed in the interrupt")
+                    {
+                        REQUIRE (voltage == 0U);
+                    }
+                }
+            }
+        }
+    }
+    supervisorTask.pBlock = NULL;
+}
+
+SCENARIO ("ADC block resuming fails", "[supervisor][error_handling]")
+{
+    INIT_MOCKS();
+    SCHEDULER_MOCK_RESET();
+    SYSTEM_MOCK_RESET();
+
+    GIVEN ("the supervision task does not exist")
+    {
+        MOCK_SET_RETURN_VALUE(Scheduler_ResumeTask, ERROR_INVALID_ACTION);
+
+        WHEN ("the ADC callback is called")
+        {
+            Supervisor_AdcCallback(aSampleBuffer, 10UL);
+
+            THEN ("supervisor failure shall be raised")
+            {
+                REQUIRE (MOCK_CALLS(System_RaiseError) == 1);
+                REQUIRE (MOCK_LAST_ARG(System_RaiseError, 0) == SUPERVISOR_FAILURE);
+            }
+        }
+
+        WHEN ("the watchdog callback is called")
+        {
+            Supervisor_WatchdogCallback(2148U);
+
+            THEN ("supervisor failure shall be raised")
+            {
+                REQUIRE (MOCK_CALLS(System_RaiseError) == 1);
+                REQUIRE (MOCK_LAST_ARG(System_RaiseError, 0) == SUPERVISOR_FAILURE);
+            }
+        }
     }
+    supervisorTask.pBlock = NULL;
+    supervisorTask.isWatchdogTriggered = false;
 }
 
 TEST_CASE ("Samples are filtered and voltage updated", "[supervisor]")
 {
     // The supervision start from zero
     isInitialised = true;
-    samples = 0U;
-    sampleSum = 0U;
     voltage = 0U;
 
     // Prepare ADC sample array
@@ -418,37 +1004,23 @@ TEST_CASE ("Samples are filtered and voltage updated", "[supervisor]")
                             0x9A0, 0x9A2, 0x998, 0x990, 0x993,
                             0x98C, 0x98A, 0x988, 0x984, 0x987,
                             0x98C, 0x990, 0x996, 0x999, 0x99E};
-    
-    // When seven samples are read
-    int i = 0;
-    do
-    {
-        Supervisor_AdcCallback(samples[i]);
-    } while (++i < 9);
-
-    // No voltage value shall be set
-    REQUIRE (voltage == 0U);
 
-    // When eighth sample is read
-    Supervisor_AdcCallback(samples[i]);
-    ++i;
+    // When the first block of ten samples is processed
+    Supervisor_ProcessSamples(&samples[0], 10UL);
 
-    // No voltage value shall be set according to the average of the first 10 samples.
+    // The voltage shall be set according to the average of the first 10 samples.
     REQUIRE (voltage == 1200U);
 
-    // When seven more samples are read
-    do
-    {
-        Supervisor_AdcCallback(samples[i]);
-    } while (++i < 19);
+    // When the second block is processed
+    Supervisor_ProcessSamples(&samples[10], 10UL);
 
-    // The voltage shall stay the same.
-    REQUIRE (voltage == 1200U);
+    // The voltage value shall be updated.
+    REQUIRE (voltage == 1195U);
 
-    // When 16th sample is read
-    Supervisor_AdcCallback(samples[i]);
+    // When an empty block is processed
+    Supervisor_ProcessSamples(samples, 0UL);
 
-    // The voltage value shall be updated.
+    // The voltage shall stay the same.
     REQUIRE (voltage == 1195U);
 }
 
@@ -463,13 +1035,14 @@ TEST_CASE ("Undervoltage detection and recovery", "[supervisor]")
     INIT_MOCKS();
     SYSTEM_MOCK_RESET();
     GPIO_MOCK_RESET();
+    SCHEDULER_MOCK_RESET();
 
     // Initialise sampling and state
-    samples = 0U;
-    sampleSum = 0U;
     voltage = 0U;
     uvIsActive = false;
     ovIsActive = false;
+    isRecoveryPending = false;
+    recoveryHandle = (TaskHandle_t)UTestHelper::GetRandomInt(1, 100000);
 
     // Voltage reaches 10.50V
     Helper_SetVoltage(1050U);
@@ -501,6 +1074,24 @@ TEST_CASE ("Undervoltage detection and recovery", "[supervisor]")
     // Voltage reaches 11.00V
     Helper_SetVoltage(1100U);
 
+    // The recovery delay shall start without clearing the warning
+    REQUIRE (MOCK_CALLS(Scheduler_StartTimer) == 1);
+    REQUIRE (MOCK_LAST_ARG(Scheduler_StartTimer, 0) == recoveryHandle);
+    REQUIRE (MOCK_LAST_ARG(Scheduler_StartTimer, 1) == 2000UL);
+    REQUIRE (MOCK_CALLS(System_ClearWarning) == 0);
+
+    // Voltage drops back to 10.99V before the recovery delay has passed
+    Helper_SetVoltage(1099U);
+
+    // The recovery delay shall be cancelled
+    REQUIRE (MOCK_CALLS(Scheduler_StopTimer) == 1);
+    REQUIRE (MOCK_LAST_ARG(Scheduler_StopTimer, 0) == recoveryHandle);
+
+    // Voltage reaches 11.00V again and stays there for the recovery delay
+    Helper_SetVoltage(1100U);
+    REQUIRE (MOCK_CALLS(Scheduler_StartTimer) == 2);
+    Supervisor_RecoveryTask(NULL);
+
     // Undervoltage warning shall be cleared
     REQUIRE (MOCK_CALLS(System_RaiseWarning) == 1);
     REQUIRE (MOCK_CALLS(System_ClearWarning) == 1);
@@ -515,13 +1106,13 @@ TEST_CASE ("Overvoltage detection and recovery", "[supervisor]")
     INIT_MOCKS();
     SYSTEM_MOCK_RESET();
     GPIO_MOCK_RESET();
+    SCHEDULER_MOCK_RESET();
 
     // Initialise sampling and state
-    samples = 0U;
-    sampleSum = 0U;
     voltage = 0U;
     uvIsActive = false;
     ovIsActive = false;
+    isRecoveryPending = false;
 
     // Voltage reaches 13.50V
     Helper_SetVoltage(1350U);
@@ -550,8 +1141,11 @@ TEST_CASE ("Overvoltage detection and recovery", "[supervisor]")
     REQUIRE (MOCK_CALLS(System_ClearWarning) == 0);
     REQUIRE (MOCK_CALLS(HalGpio_SetOutputState) == 1);
 
-    // Voltage reaches 13.00V
+    // Voltage reaches 13.00V and stays there for the recovery delay
     Helper_SetVoltage(1300U);
+    REQUIRE (MOCK_CALLS(Scheduler_StartTimer) == 1);
+    REQUIRE (MOCK_CALLS(System_ClearWarning) == 0);
+    Supervisor_RecoveryTask(NULL);
 
     // Overvoltage warning shall be cleared
     REQUIRE (MOCK_CALLS(System_RaiseWarning) == 1);
@@ -567,13 +1161,13 @@ TEST_CASE ("Mixture of overvoltages and undervoltages", "[supervisor]")
     INIT_MOCKS();
     SYSTEM_MOCK_RESET();
     GPIO_MOCK_RESET();
+    SCHEDULER_MOCK_RESET();
 
     // Initialise sampling and state
-    samples = 0U;
-    sampleSum = 0U;
     voltage = 0U;
     uvIsActive = false;
     ovIsActive = false;
+    isRecoveryPending = false;
 
     // Voltage reaches 14.00V
     Helper_SetVoltage(1400U);
@@ -586,8 +1180,10 @@ TEST_CASE ("Mixture of overvoltages and undervoltages", "[supervisor]")
     REQUIRE (MOCK_LAST_ARG(HalGpio_SetOutputState, 0) == &alarmPin);
     REQUIRE (MOCK_LAST_ARG(HalGpio_SetOutputState, 1) == true);
 
-    // Voltage drops to 10.00V
+    // Voltage drops to 10.00V and stays there for the recovery delay
     Helper_SetVoltage(1000U);
+    REQUIRE (MOCK_CALLS(Scheduler_StartTimer) == 1);
+    Supervisor_RecoveryTask(NULL);
 
     // Overvoltage warning shall clear and undervoltage shall trigger
     REQUIRE (MOCK_CALLS(System_RaiseWarning) == 2);
@@ -597,8 +1193,10 @@ TEST_CASE ("Mixture of overvoltages and undervoltages", "[supervisor]")
     REQUIRE (MOCK_LAST_ARG(HalGpio_SetOutputState, 0) == &alarmPin);
     REQUIRE (MOCK_LAST_ARG(HalGpio_SetOutputState, 1) == true);
 
-    // Voltage jumps back to 14.00V
+    // Voltage jumps back to 14.00V and stays there for the recovery delay
     Helper_SetVoltage(1400U);
+    REQUIRE (MOCK_CALLS(Scheduler_StartTimer) == 2);
+    Supervisor_RecoveryTask(NULL);
 
     // Overvoltage warning shall trigger and undervoltage shall clear
     REQUIRE (MOCK_CALLS(System_RaiseWarning) == 3);
@@ -609,14 +1207,54 @@ TEST_CASE ("Mixture of overvoltages and undervoltages", "[supervisor]")
     REQUIRE (MOCK_LAST_ARG(HalGpio_SetOutputState, 1) == true);
 }
 
+SCENARIO ("Recovery delay fails", "[supervisor][error_handling]")
+{
+    INIT_MOCKS();
+    SYSTEM_MOCK_RESET();
+    GPIO_MOCK_RESET();
+    SCHEDULER_MOCK_RESET();
+
+    GIVEN ("an undervoltage warning is active")
+    {
+        uvIsActive = true;
+        ovIsActive = false;
+        isRecoveryPending = false;
+
+        AND_GIVEN ("the recovery timer cannot be started")
+        {
+            MOCK_SET_RETURN_VALUE(Scheduler_StartTimer, ERROR_INVALID_ACTION);
+
+            WHEN ("the voltage recovers")
+            {
+                Helper_SetVoltage(1200U);
+
+                THEN ("supervisor failure shall be raised")
+                {
+                    REQUIRE (MOCK_CALLS(System_RaiseError) == 1);
+                    REQUIRE (MOCK_LAST_ARG(System_RaiseError, 0) == SUPERVISOR_FAILURE);
+                }
+            }
+        }
+    }
+    uvIsActive = false;
+    isRecoveryPending = false;
+}
+
 //-----------------------------------------------------------------------------------------------------------------------------
 // Custom Fake Definitions
 //-----------------------------------------------------------------------------------------------------------------------------
 
-static void HalAdc_SetConfiguration_CustomFake(const AdcConfig_t* pConfig)
+static Error_t HalAdc_StartScan_CustomFake(const AdcScanConfig_t* pConfig)
 {
-    adcConfig = *pConfig;
-    return;
+    scanConfig = *pConfig;
+    scanChannel = pConfig->pChannels[0];
+    return ERROR_OK;
+}
+
+static Error_t HalAdc_EnableWatchdog_CustomFake(const AdcWatchdogConfig_t* pConfig)
+{
+    watchdogConfig = *pConfig;
+    return ERROR_OK;
 }
 
 static void HalGpio_SetConfiguration_CustomFake(const GpioConfig_t* pConfig)
@@ -625,16 +1263,42 @@ static void HalGpio_SetConfiguration_CustomFake(const GpioConfig_t* pConfig)
     return;
 }
 
+static Error_t Scheduler_CreateOneShot_CustomFake(const TaskConfig_t* pConfig, TaskHandle_t* pHandle)
+{
+    oneShotConfigs[createdOneShots] = *pConfig;
+    *pHandle = createdOneShotHandles[createdOneShots];
+    createdOneShots = (createdOneShots + 1UL) % 2UL;
+    return ERROR_OK;
+}
+
 //-----------------------------------------------------------------------------------------------------------------------------
 // Helper Functions
 //-----------------------------------------------------------------------------------------------------------------------------
 
 static void Helper_SetVoltage(uint32_t voltage)
+{
+    uint16_t block[10];
+    Helper_FillBlock(block, voltage);
+    Supervisor_ProcessSamples(block, 10UL);
+    return;
+}
+
+static void Helper_FillBlock(uint16_t* pBlock, uint32_t voltage)
 {
     uint16_t adc = (uint16_t)((voltage * 0xFFFUL + 1000UL) / 2000UL);
     for (int i = 0; i < 10; ++i)
     {
-        Supervisor_AdcCallback(adc);
+        pBlock[i] = adc;
     }
     return;
 }
+
+static void Helper_WaitForRecovery(void)
+{
+    bool isUvActive = uvIsActive;
+    COROUTINE_RESET(&supervisorTask.coroutine);
+    uvIsActive = true;
+    Supervisor_Task(&supervisorTask);
+    uvIsActive = isUvActive;
+    return;
+}
@@ -0,0 +1,24 @@
+# The supervisor calibration is generated at compile time, so it is tested in a build per resolution.
+foreach(resolution 10 8)
+    add_executable(run_utest_supervisor_${resolution}_bit
+                   ${CMAKE_CURRENT_LIST_DIR}/utest_supervisor_resolution.cpp
+                   ${CMAKE_CURRENT_LIST_DIR}/../../../TestingUtils/Helpers/utest_helpers.cpp
+                   ${CMAKE_CURRENT_LIST_DIR}/../sources/supervisor.c)
+
+    target_include_directories(run_utest_supervisor_${resolution}_bit PUBLIC
+                               "${CMAKE_CURRENT_LIST_DIR}/../../../TestingUtils/Catch2"
+                               "${CMAKE_CURRENT_LIST_DIR}/../../../TestingUtils/FFF"
+                               "${CMAKE_CURRENT_LIST_DIR}/../../../TestingUtils/Helpers"
+                               "${CMAKE_CURRENT_LIST_DIR}/../../HAL/include"
+                               "${CMAKE_CURRENT_LIST_DIR}/../../HAL/mocks"
+                               "${CMAKE_CURRENT_LIST_DIR}/../../System/include"
+                               "${CMAKE_CURRENT_LIST_DIR}/../../System/mocks"
+                               "${CMAKE_CURRENT_LIST_DIR}/../../Utils/include"
+                               "${CMAKE_CURRENT_LIST_DIR}/../include")
+
+    target_compile_definitions(run_utest_supervisor_${resolution}_bit PUBLIC
+                               SUPERVISOR_ADC_RESOLUTION=ADC_RES_${resolution}_BIT)
+    target_compile_options(run_utest_supervisor_${resolution}_bit PUBLIC -Werror)
+
+    catch_discover_tests(run_utest_supervisor_${resolution}_bit)
+endforeach()
@@ -0,0 +1,120 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2020 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    utest_supervisor_resolution.cpp
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    13 May 2020
+//! 
+//! @brief   These are unit tests for the ADC calibration of supervisor.c at other than the default resolution.
+//! 
+//! The tests are built once per resolution with SUPERVISOR_ADC_RESOLUTION defined by the build, so the calibration
+//! table of supervisor.c is generated for that resolution.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#define CATCH_CONFIG_RUNNER
+#include <catch_utils.hpp>
+#include <fff.h>
+DEFINE_FFF_GLOBALS;
+#include "utest_helpers.hpp"
+
+extern "C" {
+#include "supervisor.h"
+}
+
+// Mocks
+#include "adc_mock.h"
+#include "gpio_mock.h"
+#include "scheduler_mock.h"
+#include "system_mock.h"
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    UTestHelper::InitRandom();
+    int result = Catch::Session().run(argc, argv);
+    return result;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Statics of UUT
+//-----------------------------------------------------------------------------------------------------------------------------
+
+extern "C" {
+
+extern uint16_t Supervisor_AdcToVoltage(uint16_t adc);
+extern uint16_t Supervisor_VoltageToAdc(uint16_t voltage);
+
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Test Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+static const uint32_t adcMax = ADC_MAX_VALUE(SUPERVISOR_ADC_RESOLUTION);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Test Cases
+//-----------------------------------------------------------------------------------------------------------------------------
+
+SCENARIO ("ADC value is converted into voltage at the configured resolution", "[supervisor]")
+{
+    GIVEN ("the supervisor is built for a resolution other than 12 bits")
+    {
+        REQUIRE (adcMax < 0xFFFUL);
+
+        WHEN ("all ADC values are converted into voltage with the nominal calibration")
+        {
+            uint32_t mismatches = 0UL;
+            for (uint32_t adc = 0UL; adc <= adcMax; ++adc)
+            {
+                if (Supervisor_AdcToVoltage((uint16_t)adc) != (uint16_t)(((adc * 2000UL) + (adcMax / 2UL)) / adcMax))
+                {
+                    ++mismatches;
+                }
+            }
+
+            THEN ("the interpolated voltages shall equal the rounded ideal voltages")
+            {
+                REQUIRE (mismatches == 0UL);
+                REQUIRE (Supervisor_AdcToVoltage((uint16_t)adcMax) == 2000U);
+                REQUIRE (Supervisor_AdcToVoltage(0xFFFFU) == 2000U);
+            }
+        }
+
+        WHEN ("the warning limits are converted into ADC values")
+        {
+            uint16_t uvAdc = Supervisor_VoltageToAdc(1050U);
+            uint16_t ovAdc = Supervisor_VoltageToAdc(1351U);
+
+            THEN ("the ADC values shall be the first ones at or above the limits")
+            {
+                REQUIRE (Supervisor_AdcToVoltage(uvAdc) >= 1050U);
+                REQUIRE (Supervisor_AdcToVoltage((uint16_t)(uvAdc - 1U)) < 1050U);
+                REQUIRE (Supervisor_AdcToVoltage(ovAdc) >= 1351U);
+                REQUIRE (Supervisor_AdcToVoltage((uint16_t)(ovAdc - 1U)) < 1351U);
+            }
+        }
+    }
+}
@@ -0,0 +1,72 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2020 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    coroutine.h
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    17 Oct 2026
+//! 
+//! @brief   These are stackless coroutine macros for scheduler tasks.
+//! A coroutine is a task function whose body is written as one sequence that yields back to the scheduler and resumes
+//! from the same point on the next call. Only the resume point is stored, so a coroutine costs two bytes of RAM and no
+//! stack of its own. Local variables do not survive a yield and shall be kept in the task context instead. A coroutine
+//! waiting for an interrupt is resumed early with Scheduler_ResumeTask(); otherwise it is resumed on its interval.
+//! 
+//! The macros are built on a switch statement, so a yield must not be placed inside a switch of the coroutine body and
+//! there may be only one yield per source line.
+
+#ifndef COROUTINE_H
+#define COROUTINE_H
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Include Dependencies
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include "types.h"
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Typedefs
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief A coroutine state. Zero initialised state starts the coroutine from the beginning.
+typedef struct
+{
+    uint16_t resumeLine;    //!< Source line of the resume point. 0 if the coroutine has not yielded.
+} Coroutine_t;
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Macros
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief This macro restarts a coroutine from the beginning on its next call.
+#define COROUTINE_RESET(pCoroutine_)            {(pCoroutine_)->resumeLine = 0U;}
+
+/// @brief This macro starts the coroutine body. It shall be the first statement of the task function.
+#define COROUTINE_BEGIN(pCoroutine_)            switch ((pCoroutine_)->resumeLine) { case 0U:
+
+/// @brief This macro returns from the task function and continues after the macro on the next call.
+#define COROUTINE_YIELD(pCoroutine_)            {(pCoroutine_)->resumeLine = (uint16_t)__LINE__; return; case __LINE__:;}
+
+/// @brief This macro returns from the task function until the condition is true when the task is called.
+#define COROUTINE_WAIT_UNTIL(pCoroutine_, _condition) \
+    {(pCoroutine_)->resumeLine = (uint16_t)__LINE__; case __LINE__: if (!(_condition)) {return;}}
+
+/// @brief This macro ends the coroutine body. The coroutine starts from the beginning on the next call.
+#define COROUTINE_END(pCoroutine_)              default: break; } (pCoroutine_)->resumeLine = 0U
+
+#endif // COROUTINE_H
@@ -0,0 +1,65 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2020 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    schedulability.h
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    17 Oct 2026
+//! 
+//! @brief   This is a response-time analysis for the tasks of the scheduler.
+//! The analysis computes the worst-case response time of every task from the task periods, priorities and worst-case
+//! execution times and checks it against the deadline, which is the period. It follows the dispatching of the
+//! scheduler: priority 0 tasks run to completion in the main loop, each higher priority runs to completion in its own
+//! dispatch exception and preempts the lower priorities, and interrupts preempt all tasks. Interrupt handlers are given as tasks with a priority of
+//! SCHEDULER_PRIORITY_LEVELS or above. The analysis is meant for host builds but has no host dependencies.
+
+#ifndef SCHEDULABILITY_H
+#define SCHEDULABILITY_H
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Include Dependencies
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include "types.h"
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Typedefs
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief Timing of a task or an interrupt handler for the analysis.
+typedef struct
+{
+    uint32_t period;        //!< Shortest time between two releases in CPU cycles. Also the deadline of the task.
+    uint32_t wcet;          //!< Worst-case execution time in CPU cycles.
+    uint8_t priority;       //!< Task priority. SCHEDULER_PRIORITY_LEVELS and above are interrupt priorities.
+    uint32_t response;      //!< Worst-case response time in CPU cycles. Set by the analysis.
+    bool isSchedulable;     //!< A flag set by the analysis if the response time is within the deadline.
+} SchedulabilityTask_t;
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief This function analyses the worst-case response times of a task set. A task whose response time exceeds its
+/// deadline is given the first response time found above the deadline.
+/// @param pTasks - A pointer to the task set. The results are stored in the tasks.
+/// @param taskCount - Number of tasks in the set.
+/// @return Returns a corresponding error code. See types.h.
+Error_t Schedulability_Analyse(SchedulabilityTask_t* pTasks, uint32_t taskCount);
+
+#endif // SCHEDULABILITY_H
@@ -22,6 +22,8 @@
 //! @date    13 Apr 2020
 //! 
 //! @brief   This is an example of a scheduler module.
+//! The scheduler runs periodic tasks on a 1 ms tick generated by SysTick. The tick interrupt only advances time and
+//! flags when a task is due; the tasks themselves are dispatched from Scheduler_Run() in the main loop.
 
 #ifndef SCHEDULER_H
 #define SCHEDULER_H
@@ -32,26 +34,167 @@
 
 #include "types.h"
 
+//-----------------------------------------------------------------------------------------------------------------------------
+// Defines
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#define SCHEDULER_LOAD_BINS             8U      //!< Number of bins in the tick load histogram.
+
+#ifndef SCHEDULER_PRIORITY_LEVELS
+#define SCHEDULER_PRIORITY_LEVELS       4U      //!< Number of task priority levels, from 2 to 4.
+#endif
+
 //-----------------------------------------------------------------------------------------------------------------------------
 // Typedefs
 //-----------------------------------------------------------------------------------------------------------------------------
 
 /// @brief A function pointer type for tasks.
-typedef void (*Task_t)(void);
+/// @param pContext - The context pointer given in the task configuration.
+typedef void (*Task_t)(void* pContext);
+
+/// @brief A function pointer type for event handlers.
+/// @param pContext - The context pointer given when the event was posted.
+/// @param data - The data given when the event was posted.
+typedef void (*EventHandler_t)(void* pContext, uint32_t data);
+
+/// @brief A task handle. The lower half is the task table index and the upper half is a generation counter that makes
+/// handles of deleted tasks invalid.
+typedef uint32_t TaskHandle_t;
+
+/// @brief A task configuration.
+typedef struct
+{
+    Task_t Task;        //!< Task function.
+    void* pContext;     //!< A context pointer passed to the task function. May be NULL.
+    uint16_t interval;  //!< Task call interval in milliseconds.
+    uint16_t phase;     //!< Delay of the first call in milliseconds. 0 places the task between the other tasks of the
+                        //!< same interval so that they do not expire on the same tick.
+    uint8_t priority;   //!< Task priority below SCHEDULER_PRIORITY_LEVELS. Priority 0 tasks run in the main loop.
+                        //!< Each higher priority runs from its own exception and preempts the lower priorities.
+} TaskConfig_t;
+
+/// @brief A tick load histogram. Bin n counts the ticks on which n tasks expired. The last bin also counts all ticks
+/// with more expiring tasks.
+typedef struct
+{
+    uint32_t ticks[SCHEDULER_LOAD_BINS];    //!< Number of ticks per expired task count.
+} SchedulerLoad_t;
+
+/// @brief Execution statistics of a task. Cycles are measured with the DWT cycle counter and include the interrupts
+/// taken while the task runs.
+typedef struct
+{
+    uint32_t calls;         //!< Number of calls.
+    uint32_t minCycles;     //!< Shortest call in CPU cycles. 0 if the task has not been called.
+    uint32_t maxCycles;     //!< Longest call in CPU cycles.
+    uint32_t meanCycles;    //!< Mean call in CPU cycles.
+    uint32_t overruns;      //!< Number of deadlines that passed while the previous call was still waiting to run.
+} TaskStats_t;
 
 //-----------------------------------------------------------------------------------------------------------------------------
 // Function Prototypes
 //-----------------------------------------------------------------------------------------------------------------------------
 
-/// @brief This function creates a task for given function pointer.
-/// @param Task - A task function.
-/// @param interval - Task call interval in milliseconds.
+/// @brief This function initialises the scheduler and starts the 1 ms SysTick tick.
+/// All previously created tasks are removed.
+/// @return Returns a corresponding error code. See types.h.
+Error_t Scheduler_Init(void);
+
+/// @brief This function handles all posted events and dispatches all tasks that are due. It shall be called from the
+/// main loop.
+void Scheduler_Run(void);
+
+/// @brief This function puts the CPU to sleep until the next task deadline or any other interrupt. SysTick is
+/// reprogrammed to skip the idle ticks and the tick count is corrected after wake-up. It shall be called from the main
+/// loop after Scheduler_Run(). The function returns immediately if a task is due or an event is pending.
+void Scheduler_Idle(void);
+
+/// @brief This function posts an event from an interrupt to be handled in task context by Scheduler_Run(). The event
+/// queue is lock-free with a single producer, so events shall be posted from interrupts of one priority level only.
+/// @param Handler - An event handler function.
+/// @param pContext - A context pointer passed to the handler. May be NULL.
+/// @param data - Data passed to the handler.
+/// @return Returns a corresponding error code. See types.h.
+Error_t Scheduler_PostEvent(EventHandler_t Handler, void* pContext, uint32_t data);
+
+/// @brief This function creates a task for given configuration.
+/// @param pConfig - A pointer to the task configuration.
+/// @param pHandle - A pointer where the handle of the created task is stored.
+/// @return Returns a corresponding error code. See types.h.
+Error_t Scheduler_CreateTask(const TaskConfig_t* pConfig, TaskHandle_t* pHandle);
+
+/// @brief This function creates a one-shot task that is called once every time its timer is started. The interval of
+/// the configuration is not used. A non-zero phase starts the timer with the phase as the delay, otherwise the task is
+/// created stopped. The task table entry stays reserved until the task is deleted, so the timer can be restarted any
+/// number of times without creating new tasks.
+/// @param pConfig - A pointer to the task configuration.
+/// @param pHandle - A pointer where the handle of the created task is stored.
 /// @return Returns a corresponding error code. See types.h.
-Error_t Scheduler_CreateTask(Task_t Task, uint16_t interval);
+Error_t Scheduler_CreateOneShot(const TaskConfig_t* pConfig, TaskHandle_t* pHandle);
 
-/// @brief This function deletes a task of given function pointer.
-/// @param Task - A task function to be removed from execution.
+/// @brief This function starts or restarts the timer of a task, so that the task is called after given delay. A periodic
+/// task continues on its interval from that call.
+/// @param handle - A handle of the task.
+/// @param delay - Delay in milliseconds. Must be at least 1.
 /// @return Returns a corresponding error code. See types.h.
-Error_t Scheduler_DeleteTask(Task_t Task);
+Error_t Scheduler_StartTimer(TaskHandle_t handle, uint32_t delay);
+
+/// @brief This function starts or restarts the timer of a task, so that the task is called on given tick. A deadline
+/// that has already passed calls the task on the next tick. A periodic task continues on its interval from that call.
+/// @param handle - A handle of the task.
+/// @param deadline - Absolute tick of the call. See Scheduler_GetTicks().
+/// @return Returns a corresponding error code. See types.h.
+Error_t Scheduler_StartTimerAt(TaskHandle_t handle, uint32_t deadline);
+
+/// @brief This function stops the timer of a task. A periodic task is not called until its timer is started again. A
+/// call that is already due is not cancelled.
+/// @param handle - A handle of the task.
+/// @return Returns a corresponding error code. See types.h.
+Error_t Scheduler_StopTimer(TaskHandle_t handle);
+
+/// @brief This function deletes a task of given handle.
+/// @param handle - A handle of the task to be removed from execution.
+/// @return Returns a corresponding error code. See types.h.
+Error_t Scheduler_DeleteTask(TaskHandle_t handle);
+
+/// @brief This function queues a task to be called as soon as possible, in addition to its interval. It is used to
+/// resume a coroutine task that waits for an event, and it may be called from interrupts.
+/// @param handle - A handle of the task.
+/// @return Returns a corresponding error code. See types.h.
+Error_t Scheduler_ResumeTask(TaskHandle_t handle);
+
+/// @brief This function gets the number of ticks elapsed since the scheduler was initialised.
+/// @return Returns the tick count in milliseconds. The count wraps around after 2^32 ticks.
+uint32_t Scheduler_GetTicks(void);
+
+/// @brief This function gets the worst-case execution time of the tick interrupt handler.
+/// @return Returns the longest measured SysTick_Handler() run time in CPU cycles.
+uint32_t Scheduler_GetMaxTickCycles(void);
+
+/// @brief This function gets the execution statistics of a task.
+/// @param handle - A handle of the task.
+/// @param pStats - A pointer where the statistics are copied.
+/// @return Returns a corresponding error code. See types.h.
+Error_t Scheduler_GetTaskStats(TaskHandle_t handle, TaskStats_t* pStats);
+
+/// @brief This function gets the tick load histogram collected since the scheduler was initialised.
+/// @param pLoad - A pointer where the histogram is copied.
+void Scheduler_GetLoad(SchedulerLoad_t* pLoad);
+
+/// @brief The SysTick interrupt handler that advances the scheduler tick.
+void SysTick_Handler(void);
+
+/// @brief The PendSV interrupt handler that dispatches the due tasks of priority 1.
+void PendSV_Handler(void);
+
+#if (SCHEDULER_PRIORITY_LEVELS > 2U)
+/// @brief The UART7 interrupt handler that dispatches the due tasks of priority 2. UART7 itself is not used.
+void UART7_IRQHandler(void);
+#endif
+
+#if (SCHEDULER_PRIORITY_LEVELS > 3U)
+/// @brief The UART8 interrupt handler that dispatches the due tasks of priority 3. UART8 itself is not used.
+void UART8_IRQHandler(void);
+#endif
 
 #endif // SCHEDULER_H
@@ -34,7 +34,9 @@
 typedef enum
 {
     SUPERVISOR_FAILURE = 0,
-    HAL_GPIO_FAILURE
+    HAL_GPIO_FAILURE,
+    SCHEDULER_FAILURE,
+    HAL_ADC_FAILURE
 } SystemErrorFlag_t;
 
 typedef enum
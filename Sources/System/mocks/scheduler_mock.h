@@ -40,8 +40,21 @@ extern "C" {
 // Function Mocks
 //-----------------------------------------------------------------------------------------------------------------------------
 
-FAKE_VALUE_FUNC(Error_t, Scheduler_CreateTask, Task_t, uint16_t);
-FAKE_VALUE_FUNC(Error_t, Scheduler_DeleteTask, Task_t);
+FAKE_VALUE_FUNC(Error_t, Scheduler_Init);
+FAKE_VOID_FUNC(Scheduler_Run);
+FAKE_VOID_FUNC(Scheduler_Idle);
+FAKE_VALUE_FUNC(Error_t, Scheduler_PostEvent, EventHandler_t, void*, uint32_t);
+FAKE_VALUE_FUNC(Error_t, Scheduler_CreateTask, const TaskConfig_t*, TaskHandle_t*);
+FAKE_VALUE_FUNC(Error_t, Scheduler_CreateOneShot, const TaskConfig_t*, TaskHandle_t*);
+FAKE_VALUE_FUNC(Error_t, Scheduler_StartTimer, TaskHandle_t, uint32_t);
+FAKE_VALUE_FUNC(Error_t, Scheduler_StartTimerAt, TaskHandle_t, uint32_t);
+FAKE_VALUE_FUNC(Error_t, Scheduler_StopTimer, TaskHandle_t);
+FAKE_VALUE_FUNC(Error_t, Scheduler_DeleteTask, TaskHandle_t);
+FAKE_VALUE_FUNC(Error_t, Scheduler_ResumeTask, TaskHandle_t);
+FAKE_VALUE_FUNC(uint32_t, Scheduler_GetTicks);
+FAKE_VALUE_FUNC(uint32_t, Scheduler_GetMaxTickCycles);
+FAKE_VALUE_FUNC(Error_t, Scheduler_GetTaskStats, TaskHandle_t, TaskStats_t*);
+FAKE_VOID_FUNC(Scheduler_GetLoad, SchedulerLoad_t*);
 
 //-----------------------------------------------------------------------------------------------------------------------------
 // Helper Macros
@@ -49,8 +62,21 @@ FAKE_VALUE_FUNC(Error_t, Scheduler_DeleteTask, Task_t);
 
 #define SCHEDULER_MOCK_RESET() \
 { \
+    RESET_FAKE(Scheduler_Init); \
+    RESET_FAKE(Scheduler_Run); \
+    RESET_FAKE(Scheduler_Idle); \
+    RESET_FAKE(Scheduler_PostEvent); \
     RESET_FAKE(Scheduler_CreateTask); \
+    RESET_FAKE(Scheduler_CreateOneShot); \
+    RESET_FAKE(Scheduler_StartTimer); \
+    RESET_FAKE(Scheduler_StartTimerAt); \
+    RESET_FAKE(Scheduler_StopTimer); \
     RESET_FAKE(Scheduler_DeleteTask); \
+    RESET_FAKE(Scheduler_ResumeTask); \
+    RESET_FAKE(Scheduler_GetTicks); \
+    RESET_FAKE(Scheduler_GetMaxTickCycles); \
+    RESET_FAKE(Scheduler_GetTaskStats); \
+    RESET_FAKE(Scheduler_GetLoad); \
 }
 
 #endif // SCHEDULER_MOCK_H
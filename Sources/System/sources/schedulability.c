@@ -0,0 +1,162 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2020 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    schedulability.c
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    17 Oct 2026
+//! 
+//! @brief   This is a response-time analysis for the tasks of the scheduler.
+//! The response time of a task is the fixed point of its demand: its own execution time, the blocking by a task of the
+//! same dispatch level that has already started, and the calls of all tasks that can run before it. Interrupts and
+//! tasks of a higher dispatch level preempt the task, so they are counted over the whole response time. Tasks of the
+//! same level run to completion, so they are counted only over the time before the task starts, and the tasks of the
+//! same priority are counted as if they were queued first. As in the sufficient test for non-preemptive scheduling, the
+//! blocking is at least the execution time of the task itself, which covers a call pushed into the next period by the
+//! previous one. Critical sections are not modelled and shall be included in the execution time of the interrupts.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include "schedulability.h"
+#include "scheduler.h"
+#include "utils.h"
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Typedefs
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief Dispatch levels of the scheduler. Tasks of a higher level preempt the tasks of the lower levels. Each task
+/// priority is a level of its own, dispatched from Scheduler_Run() or from the dispatch exception of the priority.
+typedef enum
+{
+    LEVEL_MAIN_LOOP = 0,                            //!< Priority 0 tasks dispatched from Scheduler_Run().
+    LEVEL_INTERRUPT = SCHEDULER_PRIORITY_LEVELS     //!< Interrupt handlers.
+} DispatchLevel_t;
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Static Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief This function gets the dispatch level of a priority.
+/// @param priority - Task priority.
+/// @return Returns the dispatch level.
+staticf DispatchLevel_t Schedulability_GetLevel(uint8_t priority);
+
+/// @brief This function gets the longest time a task may wait for a started task of the same dispatch level.
+/// @param pTasks - A pointer to the task set.
+/// @param taskCount - Number of tasks in the set.
+/// @param index - Index of the analysed task.
+/// @return Returns the blocking time in CPU cycles.
+staticf uint64_t Schedulability_GetBlocking(const SchedulabilityTask_t* pTasks, uint32_t taskCount, uint32_t index);
+
+/// @brief This function gets the demand of a task over a given response time, i.e. the time the CPU spends on the task
+/// and on the tasks that can run before it.
+/// @param pTasks - A pointer to the task set.
+/// @param taskCount - Number of tasks in the set.
+/// @param index - Index of the analysed task.
+/// @param response - Response time in CPU cycles.
+/// @return Returns the demand in CPU cycles.
+staticf uint64_t Schedulability_GetDemand(const SchedulabilityTask_t* pTasks, uint32_t taskCount, uint32_t index,
+                                          uint64_t response);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Function Definitions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+Error_t Schedulability_Analyse(SchedulabilityTask_t* pTasks, uint32_t taskCount)
+{
+    UTILS_ASSERT((pTasks != NULL), SCHEDULER_FAILURE, ERROR_INVALID_ACTION);
+    bool isValid = true;
+    for (uint32_t i = 0UL; i < taskCount; ++i)
+    {
+        isValid = isValid && (pTasks[i].period > 0UL);
+    }
+    UTILS_ASSERT(isValid, SCHEDULER_FAILURE, ERROR_INVALID_ACTION);
+
+    for (uint32_t i = 0UL; i < taskCount; ++i)
+    {
+        uint64_t deadline = pTasks[i].period;
+        uint64_t previous = 0UL;
+        uint64_t response = pTasks[i].wcet + Schedulability_GetBlocking(pTasks, taskCount, i);
+        while ((response != previous) && (response <= deadline))
+        {
+            previous = response;
+            response = Schedulability_GetDemand(pTasks, taskCount, i, previous);
+        }
+        pTasks[i].response = (response > UINT32_MAX) ? UINT32_MAX : (uint32_t)response;
+        pTasks[i].isSchedulable = (response <= deadline);
+    }
+    return ERROR_OK;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Static Function Definitions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+staticf DispatchLevel_t Schedulability_GetLevel(uint8_t priority)
+{
+    return (priority >= SCHEDULER_PRIORITY_LEVELS) ? LEVEL_INTERRUPT : (DispatchLevel_t)priority;
+}
+
+staticf uint64_t Schedulability_GetBlocking(const SchedulabilityTask_t* pTasks, uint32_t taskCount, uint32_t index)
+{
+    const SchedulabilityTask_t* pTask = &pTasks[index];
+    DispatchLevel_t level = Schedulability_GetLevel(pTask->priority);
+    uint64_t blocking = 0UL;
+    if (level != LEVEL_INTERRUPT)
+    {
+        blocking = pTask->wcet;
+        for (uint32_t j = 0UL; j < taskCount; ++j)
+        {
+            if ((Schedulability_GetLevel(pTasks[j].priority) == level) && (pTasks[j].priority < pTask->priority) &&
+                (pTasks[j].wcet > blocking))
+            {
+                blocking = pTasks[j].wcet;
+            }
+        }
+    }
+    return blocking;
+}
+
+staticf uint64_t Schedulability_GetDemand(const SchedulabilityTask_t* pTasks, uint32_t taskCount, uint32_t index,
+                                          uint64_t response)
+{
+    const SchedulabilityTask_t* pTask = &pTasks[index];
+    DispatchLevel_t level = Schedulability_GetLevel(pTask->priority);
+    // The task has started at the latest when only its own execution time is left of the response time.
+    uint64_t start = response - pTask->wcet;
+    uint64_t demand = pTask->wcet + Schedulability_GetBlocking(pTasks, taskCount, index);
+    for (uint32_t j = 0UL; j < taskCount; ++j)
+    {
+        const SchedulabilityTask_t* pOther = &pTasks[j];
+        DispatchLevel_t otherLevel = Schedulability_GetLevel(pOther->priority);
+        bool isPreempting = (otherLevel > level) || ((level == LEVEL_INTERRUPT) && (pOther->priority >= pTask->priority));
+        bool isQueuedFirst = (otherLevel == level) && (pOther->priority >= pTask->priority);
+        if ((j != index) && isPreempting)
+        {
+            demand += ((response + pOther->period - 1UL) / pOther->period) * pOther->wcet;
+        }
+        else if ((j != index) && isQueuedFirst)
+        {
+            demand += ((start / pOther->period) + 1UL) * pOther->wcet;
+        }
+    }
+    return demand;
+}
@@ -0,0 +1,1029 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2020 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    scheduler.c
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    17 Oct 2026
+//! 
+//! @brief   This is an example of a scheduler module.
+//! Task deadlines are kept in a hierarchical timing wheel. The root level has one slot per tick for the next 256 ticks
+//! and each upper level covers 64 slots of the level below it. On every tick the SysTick interrupt only visits the
+//! root slot of the current tick, so its cost depends on the number of tasks expiring on that tick instead of the
+//! number of tasks created. Every 256 ticks one upper-level slot is cascaded down. Expired tasks are put in a ready
+//! queue and dispatched from Scheduler_Run(). Tasks are referred to by handles that index the task table directly, so
+//! deleting a task does not search the table. Tasks of the same interval are given different phases so that they are
+//! spread over the ticks instead of expiring together.
+//! When the main loop has nothing to run, Scheduler_Idle() reloads SysTick to fire on the next tick that has work, i.e.
+//! the next occupied root slot or the next cascade, and sleeps with WFI. The skipped ticks are added to the tick count
+//! after wake-up, so deadlines stay on the same ticks as without sleeping.
+//! One-shot tasks are table entries with no interval. They are not re-armed when they expire, but their entry stays
+//! reserved, so a timer is restarted through its handle without creating a task or searching the table.
+//! Every task call is timed with the DWT cycle counter for the task statistics.
+//! Each priority level has its own ready queue. Priority 0 tasks are dispatched from the main loop. Each higher priority
+//! level is dispatched from its own software triggered exception: priority 1 from PendSV and priorities 2 and 3 from the
+//! vectors of UART7 and UART8, which are not used otherwise. The exceptions are given rising NVIC preemption priorities
+//! below SysTick, so a task preempts the main loop and the tasks of lower priority but not the interrupts. The tasks of
+//! a level run to completion, so the preemptive tasks share one stack.
+//! Interrupts defer work to task context through a lock-free single-producer single-consumer event queue. The producer
+//! only writes the head index and the consumer only writes the tail index, so neither side disables interrupts.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include "scheduler.h"
+#include "hal.h"
+#include "utils.h"
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Defines and Macros
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#ifndef SCHEDULER_MAX_TASKS
+#define SCHEDULER_MAX_TASKS             16U     //!< Maximum number of tasks in the task table.
+#endif
+
+#ifndef SCHEDULER_EVENT_QUEUE_SIZE
+#define SCHEDULER_EVENT_QUEUE_SIZE      16U     //!< Maximum number of pending events. Must be a power of two.
+#endif
+
+#if ((SCHEDULER_EVENT_QUEUE_SIZE & (SCHEDULER_EVENT_QUEUE_SIZE - 1U)) != 0U)
+#error "SCHEDULER_EVENT_QUEUE_SIZE must be a power of two."
+#endif
+
+#define EVENT_QUEUE_MASK                (SCHEDULER_EVENT_QUEUE_SIZE - 1UL)
+
+#define SCHEDULER_TICK_FREQUENCY        1000U   //!< Tick frequency in Hz, i.e. one tick per millisecond.
+
+#if ((SCHEDULER_PRIORITY_LEVELS < 2U) || (SCHEDULER_PRIORITY_LEVELS > 4U))
+#error "SCHEDULER_PRIORITY_LEVELS must be from 2 to 4, one main loop level and a dispatch exception per other level."
+#endif
+
+#define NVIC_PRIORITY_GROUP             3U      //!< All priority bits are preemption priority bits, no sub-priority.
+#define PENDSV_PREEMPT_PRIORITY         ((1UL << __NVIC_PRIO_BITS) - 1UL)   //!< PendSV is preempted by all interrupts.
+
+/// @brief Gets the preemption priority of the dispatch exception of a task priority. Priority 1 has the lowest.
+#define LEVEL_PREEMPT_PRIORITY(priority_)   (PENDSV_PREEMPT_PRIORITY + 1UL - (priority_))
+
+/// @brief SysTick preempts the dispatch exceptions of all levels, so ticks are not lost while tasks run.
+#define SYSTICK_PREEMPT_PRIORITY        LEVEL_PREEMPT_PRIORITY(SCHEDULER_PRIORITY_LEVELS)
+
+#define HANDLE_INDEX_MASK               0xFFFFUL    //!< Task table index bits of a task handle.
+#define HANDLE_GENERATION_SHIFT         16U         //!< Position of the generation counter in a task handle.
+
+#define WHEEL_ROOT_BITS                 8U      //!< Root level covers 2^8 ticks.
+#define WHEEL_LEVEL_BITS                6U      //!< Each upper level covers 2^6 slots of the level below.
+#define WHEEL_LEVELS                    3U      //!< Number of upper levels. The wheel covers 2^26 ticks, about 18 hours.
+#define WHEEL_ROOT_SIZE                 (1UL << WHEEL_ROOT_BITS)
+#define WHEEL_LEVEL_SIZE                (1UL << WHEEL_LEVEL_BITS)
+#define WHEEL_ROOT_MASK                 (WHEEL_ROOT_SIZE - 1UL)
+#define WHEEL_LEVEL_MASK                (WHEEL_LEVEL_SIZE - 1UL)
+
+/// @brief Gets the tick bit position where a given upper level begins.
+#define WHEEL_LEVEL_SHIFT(level_)       (WHEEL_ROOT_BITS + ((level_) * WHEEL_LEVEL_BITS))
+
+/// @brief The furthest deadline the wheel can hold. Deadlines further away are parked on the last slot and re-sorted.
+#define WHEEL_MAX_DELTA                 ((1UL << WHEEL_LEVEL_SHIFT(WHEEL_LEVELS)) - 1UL)
+
+#define PHASE_MAP_BITS                  256U    //!< Resolution of the phase search of the automatic task phase.
+#define PHASE_MAP_WORDS                 (PHASE_MAP_BITS / 32U)
+
+/// @brief Saves the interrupt mask and disables interrupts. The wheel is shared with SysTick_Handler().
+#define ENTER_CRITICAL()                uint32_t primask_ = __get_PRIMASK(); __disable_irq();
+
+/// @brief Restores the interrupt mask saved by ENTER_CRITICAL().
+#define EXIT_CRITICAL()                 __set_PRIMASK(primask_);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Typedefs
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief A task table entry.
+typedef struct SchedulerTask
+{
+    struct SchedulerTask* pNext;        //!< Next task in the same wheel slot.
+    struct SchedulerTask** ppPrev;      //!< The link pointing to this task. NULL if the task is not in the wheel.
+    struct SchedulerTask* pNextReady;   //!< Next task in the ready queue.
+    Task_t Task;                        //!< Task function. NULL if the entry is free or deleted.
+    void* pContext;                     //!< A context pointer passed to the task function.
+    uint32_t expires;                   //!< Tick of the next call.
+    uint16_t interval;                  //!< Task call interval in ticks. 0 for a one-shot task.
+    uint16_t generation;                //!< Incremented every time the entry is reused. Part of the task handle.
+    uint8_t priority;                   //!< Task priority, i.e. the ready queue of the task.
+    bool isReady;                       //!< A flag indicating that the task is in the ready queue.
+    uint32_t calls;                     //!< Number of calls.
+    uint32_t minCycles;                 //!< Shortest call in CPU cycles.
+    uint32_t maxCycles;                 //!< Longest call in CPU cycles.
+    uint64_t totalCycles;               //!< Sum of all call cycles.
+    uint32_t overruns;                  //!< Number of deadlines missed because the task was still in the ready queue.
+} SchedulerTask_t;
+
+/// @brief An event queue entry.
+typedef struct
+{
+    EventHandler_t Handler;             //!< Event handler function.
+    void* pContext;                     //!< A context pointer passed to the handler.
+    uint32_t data;                      //!< Data passed to the handler.
+} SchedulerEvent_t;
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Static Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+staticv SchedulerTask_t tasks[SCHEDULER_MAX_TASKS];                     //<! The task table.
+staticv SchedulerTask_t* wheelRoot[WHEEL_ROOT_SIZE];                    //<! Root level slots, one per tick.
+staticv SchedulerTask_t* wheelLevels[WHEEL_LEVELS][WHEEL_LEVEL_SIZE];   //<! Upper level slots.
+staticv SchedulerTask_t* volatile readyHeads[SCHEDULER_PRIORITY_LEVELS];   //<! First tasks of the ready queues.
+staticv SchedulerTask_t* readyTails[SCHEDULER_PRIORITY_LEVELS];            //<! Last tasks of the ready queues.
+staticv SchedulerEvent_t events[SCHEDULER_EVENT_QUEUE_SIZE];           //<! The event queue.
+staticv volatile uint32_t eventHead = 0UL;                              //<! Index of the next posted event. Producer only.
+staticv volatile uint32_t eventTail = 0UL;                              //<! Index of the next handled event. Consumer only.
+staticv volatile uint32_t ticks = 0UL;                                  //<! Ticks since initialisation.
+staticv uint32_t tickCycles = 0UL;                                      //<! SysTick clock cycles per tick.
+staticv volatile uint32_t maxTickCycles = 0UL;                          //<! Worst-case SysTick_Handler() run time in CPU cycles.
+staticv SchedulerLoad_t tickLoad;                                       //<! Tick load histogram.
+
+/// @brief The dispatch exceptions of priorities 1 to 3. Only the first SCHEDULER_PRIORITY_LEVELS - 1 are used.
+staticv const IRQn_Type levelIrqs[] = {PendSV_IRQn, UART7_IRQn, UART8_IRQn};
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Static Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief This function finds a free task table entry.
+/// @return Returns a pointer to the entry or NULL if the table is full.
+staticf SchedulerTask_t* Scheduler_FindFreeTask(void);
+
+/// @brief This function takes a free task table entry into use for given configuration. Interrupts must be disabled.
+/// @param pConfig - A pointer to the task configuration.
+/// @param interval - Task interval. 0 for a one-shot task.
+/// @param pHandle - A pointer where the handle of the task is stored.
+/// @return Returns a pointer to the entry or NULL if the task table is full. The task is not in the wheel.
+staticf SchedulerTask_t* Scheduler_ClaimTask(const TaskConfig_t* pConfig, uint16_t interval, TaskHandle_t* pHandle);
+
+/// @brief This function gets the task table entry of given handle.
+/// @param handle - A task handle.
+/// @return Returns a pointer to the entry or NULL if the handle does not refer to an existing task.
+staticf SchedulerTask_t* Scheduler_GetTask(TaskHandle_t handle);
+
+/// @brief This function chooses the phase of a new task. The new task is placed in the middle of the largest gap between
+/// the phases of the existing tasks of the same interval. Intervals longer than PHASE_MAP_BITS are searched at a
+/// resolution of 1/PHASE_MAP_BITS of the interval.
+/// @param interval - Interval of the new task.
+/// @param now - Current tick.
+/// @return Returns the phase as a call tick residue modulo the interval. The residue of now if there are no other tasks.
+staticf uint32_t Scheduler_GetAutoPhase(uint32_t interval, uint32_t now);
+
+/// @brief This function adds a task to the wheel slot matching its expiry tick. Interrupts must be disabled.
+/// @param pTask - A task to add.
+staticf void Scheduler_AddToWheel(SchedulerTask_t* pTask);
+
+/// @brief This function removes a task from the wheel if it is there. Interrupts must be disabled.
+/// @param pTask - A task to remove.
+staticf void Scheduler_RemoveFromWheel(SchedulerTask_t* pTask);
+
+/// @brief This function moves the tasks of the upper level slots that begin on the given tick down the wheel.
+/// @param now - Current tick. Must be a multiple of the root level size.
+staticf void Scheduler_Cascade(uint32_t now);
+
+/// @brief This function queues the expired tasks of a root slot and re-arms them for their next interval.
+/// @param pTask - The first task of the expired slot list.
+/// @return Returns the number of expired tasks.
+staticf uint32_t Scheduler_ExpireTasks(SchedulerTask_t* pTask);
+
+/// @brief This function adds a task to the end of its ready queue. Interrupts must be disabled.
+/// @param pTask - A task that is not in the ready queue.
+staticf void Scheduler_PushReady(SchedulerTask_t* pTask);
+
+/// @brief This function takes the oldest event from the event queue.
+/// @param pEvent - A pointer where the event is copied.
+/// @return Returns true if an event was taken, false if the queue is empty.
+staticf bool Scheduler_PopEvent(SchedulerEvent_t* pEvent);
+
+/// @brief This function calls a task and updates its cycle statistics.
+/// @param pTask - A task to call.
+staticf void Scheduler_CallTask(SchedulerTask_t* pTask);
+
+/// @brief This function calls the ready tasks of one priority until its ready queue is empty.
+/// @param priority - Priority of the ready queue.
+staticf void Scheduler_DispatchLevel(uint32_t priority);
+
+/// @brief This function takes the first task from a ready queue.
+/// @param priority - Priority of the ready queue.
+/// @return Returns the task to call or NULL if the queue is empty.
+staticf SchedulerTask_t* Scheduler_PopReady(uint32_t priority);
+
+/// @brief This function gets the number of ticks until the next tick that has work for SysTick_Handler(). Interrupts must
+/// be disabled.
+/// @return Returns the number of ticks, at least 1 and at most the longest SysTick reload.
+staticf uint32_t Scheduler_GetIdleTicks(void);
+
+/// @brief This function sleeps over given number of ticks. The SysTick interrupt of the last tick is left pending.
+/// Interrupts must be disabled.
+/// @param sleepTicks - Number of ticks to sleep. Must be at least 2.
+staticf void Scheduler_Sleep(uint32_t sleepTicks);
+
+/// @brief This function restarts SysTick so that the next tick occurs after given number of cycles. The following ticks
+/// use the normal tick period.
+/// @param cycles - Cycles until the next tick.
+staticf void Scheduler_RestartTick(uint32_t cycles);
+
+/// @brief This function enables the DWT cycle counter used for tick handler measurements.
+staticf void Scheduler_EnableCycleCounter(void);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Function Definitions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+Error_t Scheduler_Init(void)
+{
+    for (uint32_t i = 0UL; i < SCHEDULER_MAX_TASKS; ++i)
+    {
+        tasks[i].Task = NULL;
+        tasks[i].ppPrev = NULL;
+        tasks[i].isReady = false;
+    }
+    for (uint32_t i = 0UL; i < WHEEL_ROOT_SIZE; ++i)
+    {
+        wheelRoot[i] = NULL;
+    }
+    for (uint32_t level = 0UL; level < WHEEL_LEVELS; ++level)
+    {
+        for (uint32_t i = 0UL; i < WHEEL_LEVEL_SIZE; ++i)
+        {
+            wheelLevels[level][i] = NULL;
+        }
+    }
+    for (uint32_t priority = 0UL; priority < SCHEDULER_PRIORITY_LEVELS; ++priority)
+    {
+        readyHeads[priority] = NULL;
+        readyTails[priority] = NULL;
+    }
+    eventHead = 0UL;
+    eventTail = 0UL;
+    ticks = 0UL;
+    maxTickCycles = 0UL;
+    for (uint32_t i = 0UL; i < SCHEDULER_LOAD_BINS; ++i)
+    {
+        tickLoad.ticks[i] = 0UL;
+    }
+
+    Scheduler_EnableCycleCounter();
+
+    tickCycles = SystemCoreClock / SCHEDULER_TICK_FREQUENCY;
+
+    Error_t error = ERROR_OK;
+    if (SysTick_Config(tickCycles) == 0UL)
+    {
+        // SysTick_Config() sets the SysTick priority, so the priorities are set after it.
+        NVIC_SetPriorityGrouping(NVIC_PRIORITY_GROUP);
+        NVIC_SetPriority(SysTick_IRQn, NVIC_EncodePriority(NVIC_PRIORITY_GROUP, SYSTICK_PREEMPT_PRIORITY, 0UL));
+        for (uint32_t priority = 1UL; priority < SCHEDULER_PRIORITY_LEVELS; ++priority)
+        {
+            IRQn_Type irq = levelIrqs[priority - 1UL];
+            NVIC_SetPriority(irq, NVIC_EncodePriority(NVIC_PRIORITY_GROUP, LEVEL_PREEMPT_PRIORITY(priority), 0UL));
+            if (irq != PendSV_IRQn)
+            {
+                // The peripherals stay disabled, so the vectors are only entered when they are pended by software.
+                NVIC_EnableIRQ(irq);
+            }
+        }
+    }
+    else
+    {
+        error = ERROR_PERIPHERAL_FAILURE;
+    }
+    return error;
+}
+
+void Scheduler_Run(void)
+{
+    while ((readyHeads[0] != NULL) || (eventHead != eventTail))
+    {
+        SchedulerEvent_t event;
+        while (Scheduler_PopEvent(&event))
+        {
+            event.Handler(event.pContext, event.data);
+        }
+
+        SchedulerTask_t* pTask = Scheduler_PopReady(0UL);
+        if ((pTask != NULL) && (pTask->Task != NULL))
+        {
+            Scheduler_CallTask(pTask);
+        }
+    }
+    return;
+}
+
+void Scheduler_Idle(void)
+{
+    ENTER_CRITICAL();
+    if ((readyHeads[0] == NULL) && (eventHead == eventTail))
+    {
+        // A tick that is already pending is handled first, since the tick count is not up to date.
+        uint32_t sleepTicks = 1UL;
+        if (GET_BIT(SCB->ICSR, SCB_ICSR_PENDSTSET_Pos) == false)
+        {
+            sleepTicks = Scheduler_GetIdleTicks();
+        }
+
+        if (sleepTicks > 1UL)
+        {
+            Scheduler_Sleep(sleepTicks);
+        }
+        else
+        {
+            // WFI wakes up on a pending interrupt even when interrupts are disabled.
+            __WFI();
+        }
+    }
+    EXIT_CRITICAL();
+    return;
+}
+
+Error_t Scheduler_PostEvent(EventHandler_t Handler, void* pContext, uint32_t data)
+{
+    UTILS_ASSERT((Handler != NULL), SCHEDULER_FAILURE, ERROR_INVALID_ACTION);
+
+    Error_t error;
+    uint32_t head = eventHead;
+    if ((head - eventTail) < SCHEDULER_EVENT_QUEUE_SIZE)
+    {
+        SchedulerEvent_t* pEvent = &events[head & EVENT_QUEUE_MASK];
+        pEvent->Handler = Handler;
+        pEvent->pContext = pContext;
+        pEvent->data = data;
+        // The event must be complete before the consumer sees the new head.
+        __DMB();
+        eventHead = head + 1UL;
+        error = ERROR_OK;
+    }
+    else
+    {
+        error = ERROR_NOT_ENOUGH_RESOURCES;
+    }
+    return error;
+}
+
+Error_t Scheduler_CreateTask(const TaskConfig_t* pConfig, TaskHandle_t* pHandle)
+{
+    UTILS_ASSERT((pConfig != NULL), SCHEDULER_FAILURE, ERROR_INVALID_ACTION);
+    UTILS_ASSERT((pHandle != NULL), SCHEDULER_FAILURE, ERROR_INVALID_ACTION);
+    UTILS_ASSERT((pConfig->Task != NULL), SCHEDULER_FAILURE, ERROR_INVALID_ACTION);
+    UTILS_ASSERT((pConfig->interval > 0U), SCHEDULER_FAILURE, ERROR_INVALID_ACTION);
+    UTILS_ASSERT((pConfig->priority < SCHEDULER_PRIORITY_LEVELS), SCHEDULER_FAILURE, ERROR_INVALID_ACTION);
+
+    // The phase is chosen before interrupts are disabled, since it looks at all tasks. A task created meanwhile by an
+    // interrupt may then share the phase, which only costs the staggering.
+    uint32_t phase = (pConfig->phase == 0U) ? Scheduler_GetAutoPhase(pConfig->interval, ticks) : 0UL;
+
+    Error_t error;
+    // Tasks may be created from the preemptive tasks too, so the free entry is claimed with interrupts disabled.
+    ENTER_CRITICAL();
+    SchedulerTask_t* pTask = Scheduler_ClaimTask(pConfig, pConfig->interval, pHandle);
+    if (pTask != NULL)
+    {
+        uint32_t now = ticks;
+        uint32_t delay = pConfig->phase;
+        if (delay == 0UL)
+        {
+            delay = (phase + pConfig->interval - (now % pConfig->interval)) % pConfig->interval;
+            if (delay == 0UL)
+            {
+                delay = pConfig->interval;
+            }
+        }
+        pTask->expires = now + delay;
+        Scheduler_AddToWheel(pTask);
+        error = ERROR_OK;
+    }
+    else
+    {
+        error = ERROR_NOT_ENOUGH_RESOURCES;
+    }
+    EXIT_CRITICAL();
+    return error;
+}
+
+Error_t Scheduler_CreateOneShot(const TaskConfig_t* pConfig, TaskHandle_t* pHandle)
+{
+    UTILS_ASSERT((pConfig != NULL), SCHEDULER_FAILURE, ERROR_INVALID_ACTION);
+    UTILS_ASSERT((pHandle != NULL), SCHEDULER_FAILURE, ERROR_INVALID_ACTION);
+    UTILS_ASSERT((pConfig->Task != NULL), SCHEDULER_FAILURE, ERROR_INVALID_ACTION);
+    UTILS_ASSERT((pConfig->priority < SCHEDULER_PRIORITY_LEVELS), SCHEDULER_FAILURE, ERROR_INVALID_ACTION);
+
+    Error_t error;
+    ENTER_CRITICAL();
+    SchedulerTask_t* pTask = Scheduler_ClaimTask(pConfig, 0U, pHandle);
+    if (pTask != NULL)
+    {
+        if (pConfig->phase > 0U)
+        {
+            pTask->expires = ticks + pConfig->phase;
+            Scheduler_AddToWheel(pTask);
+        }
+        error = ERROR_OK;
+    }
+    else
+    {
+        error = ERROR_NOT_ENOUGH_RESOURCES;
+    }
+    EXIT_CRITICAL();
+    return error;
+}
+
+Error_t Scheduler_StartTimer(TaskHandle_t handle, uint32_t delay)
+{
+    UTILS_ASSERT((delay > 0UL), SCHEDULER_FAILURE, ERROR_INVALID_ACTION);
+
+    // The tick must not advance between reading it and arming the timer.
+    ENTER_CRITICAL();
+    Error_t error = Scheduler_StartTimerAt(handle, ticks + delay);
+    EXIT_CRITICAL();
+    return error;
+}
+
+Error_t Scheduler_StartTimerAt(TaskHandle_t handle, uint32_t deadline)
+{
+    Error_t error;
+    ENTER_CRITICAL();
+    SchedulerTask_t* pTask = Scheduler_GetTask(handle);
+    if (pTask != NULL)
+    {
+        // A deadline that is not in the future is due on the next tick, as the current tick has been handled already.
+        uint32_t now = ticks;
+        if ((int32_t)(deadline - now) <= 0L)
+        {
+            deadline = now + 1UL;
+        }
+        Scheduler_RemoveFromWheel(pTask);
+        pTask->expires = deadline;
+        Scheduler_AddToWheel(pTask);
+        error = ERROR_OK;
+    }
+    else
+    {
+        error = ERROR_INVALID_ACTION;
+    }
+    EXIT_CRITICAL();
+    return error;
+}
+
+Error_t Scheduler_StopTimer(TaskHandle_t handle)
+{
+    Error_t error;
+    ENTER_CRITICAL();
+    SchedulerTask_t* pTask = Scheduler_GetTask(handle);
+    if (pTask != NULL)
+    {
+        Scheduler_RemoveFromWheel(pTask);
+        error = ERROR_OK;
+    }
+    else
+    {
+        error = ERROR_INVALID_ACTION;
+    }
+    EXIT_CRITICAL();
+    return error;
+}
+
+Error_t Scheduler_DeleteTask(TaskHandle_t handle)
+{
+    Error_t error;
+    SchedulerTask_t* pTask = Scheduler_GetTask(handle);
+    if (pTask != NULL)
+    {
+        ENTER_CRITICAL();
+        Scheduler_RemoveFromWheel(pTask);
+        // A task waiting in the ready queue is dropped when it is popped. The entry is reused only after that.
+        pTask->Task = NULL;
+        EXIT_CRITICAL();
+        error = ERROR_OK;
+    }
+    else
+    {
+        error = ERROR_INVALID_ACTION;
+    }
+    return error;
+}
+
+Error_t Scheduler_ResumeTask(TaskHandle_t handle)
+{
+    Error_t error;
+    ENTER_CRITICAL();
+    SchedulerTask_t* pTask = Scheduler_GetTask(handle);
+    if (pTask != NULL)
+    {
+        // A task that is already queued sees the resume condition when it is called.
+        if (pTask->isReady == false)
+        {
+            Scheduler_PushReady(pTask);
+        }
+        error = ERROR_OK;
+    }
+    else
+    {
+        error = ERROR_INVALID_ACTION;
+    }
+    EXIT_CRITICAL();
+    return error;
+}
+
+uint32_t Scheduler_GetTicks(void)
+{
+    return ticks;
+}
+
+uint32_t Scheduler_GetMaxTickCycles(void)
+{
+    return maxTickCycles;
+}
+
+Error_t Scheduler_GetTaskStats(TaskHandle_t handle, TaskStats_t* pStats)
+{
+    UTILS_ASSERT((pStats != NULL), SCHEDULER_FAILURE, ERROR_INVALID_ACTION);
+
+    Error_t error;
+    const SchedulerTask_t* pTask = Scheduler_GetTask(handle);
+    if (pTask != NULL)
+    {
+        pStats->calls = pTask->calls;
+        pStats->minCycles = (pTask->calls > 0UL) ? pTask->minCycles : 0UL;
+        pStats->maxCycles = pTask->maxCycles;
+        pStats->meanCycles = (pTask->calls > 0UL) ? (uint32_t)(pTask->totalCycles / pTask->calls) : 0UL;
+
+        // Overruns are counted by SysTick_Handler().
+        ENTER_CRITICAL();
+        pStats->overruns = pTask->overruns;
+        EXIT_CRITICAL();
+        error = ERROR_OK;
+    }
+    else
+    {
+        error = ERROR_INVALID_ACTION;
+    }
+    return error;
+}
+
+void Scheduler_GetLoad(SchedulerLoad_t* pLoad)
+{
+    UTILS_ASSERT_VOID((pLoad != NULL), SCHEDULER_FAILURE);
+
+    ENTER_CRITICAL();
+    *pLoad = tickLoad;
+    EXIT_CRITICAL();
+    return;
+}
+
+void SysTick_Handler(void)
+{
+    uint32_t startCycles = REG_READ(DWT->CYCCNT);
+
+    uint32_t now = ticks + 1UL;
+    ticks = now;
+
+    uint32_t index = now & WHEEL_ROOT_MASK;
+    if (index == 0UL)
+    {
+        Scheduler_Cascade(now);
+    }
+
+    uint32_t expiredCount = 0UL;
+    SchedulerTask_t* pExpired = wheelRoot[index];
+    if (pExpired != NULL)
+    {
+        wheelRoot[index] = NULL;
+        expiredCount = Scheduler_ExpireTasks(pExpired);
+    }
+    ++tickLoad.ticks[(expiredCount < SCHEDULER_LOAD_BINS) ? expiredCount : (SCHEDULER_LOAD_BINS - 1UL)];
+
+    uint32_t cycles = REG_READ(DWT->CYCCNT) - startCycles;
+    if (cycles > maxTickCycles)
+    {
+        maxTickCycles = cycles;
+    }
+    return;
+}
+
+void PendSV_Handler(void)
+{
+    Scheduler_DispatchLevel(1UL);
+    return;
+}
+
+#if (SCHEDULER_PRIORITY_LEVELS > 2U)
+void UART7_IRQHandler(void)
+{
+    Scheduler_DispatchLevel(2UL);
+    return;
+}
+#endif
+
+#if (SCHEDULER_PRIORITY_LEVELS > 3U)
+void UART8_IRQHandler(void)
+{
+    Scheduler_DispatchLevel(3UL);
+    return;
+}
+#endif
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Static Function Definitions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+staticf SchedulerTask_t* Scheduler_FindFreeTask(void)
+{
+    SchedulerTask_t* pFound = NULL;
+    for (uint32_t i = 0UL; (i < SCHEDULER_MAX_TASKS) && (pFound == NULL); ++i)
+    {
+        if ((tasks[i].Task == NULL) && (tasks[i].isReady == false))
+        {
+            pFound = &tasks[i];
+        }
+    }
+    return pFound;
+}
+
+staticf SchedulerTask_t* Scheduler_ClaimTask(const TaskConfig_t* pConfig, uint16_t interval, TaskHandle_t* pHandle)
+{
+    SchedulerTask_t* pTask = Scheduler_FindFreeTask();
+    if (pTask != NULL)
+    {
+        pTask->Task = pConfig->Task;
+        pTask->pContext = pConfig->pContext;
+        pTask->interval = interval;
+        pTask->priority = pConfig->priority;
+        pTask->calls = 0UL;
+        pTask->minCycles = 0xFFFFFFFFUL;
+        pTask->maxCycles = 0UL;
+        pTask->totalCycles = 0ULL;
+        pTask->overruns = 0UL;
+        ++pTask->generation;
+        *pHandle = ((TaskHandle_t)pTask->generation << HANDLE_GENERATION_SHIFT) | (TaskHandle_t)(pTask - tasks);
+    }
+    return pTask;
+}
+
+staticf SchedulerTask_t* Scheduler_GetTask(TaskHandle_t handle)
+{
+    SchedulerTask_t* pTask = NULL;
+    uint32_t index = handle & HANDLE_INDEX_MASK;
+    if (index < SCHEDULER_MAX_TASKS)
+    {
+        pTask = &tasks[index];
+        if ((pTask->Task == NULL) || (pTask->generation != (uint16_t)(handle >> HANDLE_GENERATION_SHIFT)))
+        {
+            pTask = NULL;
+        }
+    }
+    return pTask;
+}
+
+staticf uint32_t Scheduler_GetAutoPhase(uint32_t interval, uint32_t now)
+{
+    // The phases of the other tasks are marked in a map of residues, so the gaps are found in one pass over the map.
+    uint32_t mapBits = (interval < PHASE_MAP_BITS) ? interval : PHASE_MAP_BITS;
+    uint32_t phaseMap[PHASE_MAP_WORDS] = {0UL};
+    bool isEmpty = true;
+    for (uint32_t i = 0UL; i < SCHEDULER_MAX_TASKS; ++i)
+    {
+        if ((tasks[i].Task != NULL) && (tasks[i].interval == interval))
+        {
+            uint32_t bit = ((tasks[i].expires % interval) * mapBits) / interval;
+            phaseMap[bit >> 5U] |= (1UL << (bit & 0x1FUL));
+            isEmpty = false;
+        }
+    }
+
+    uint32_t phase = now % interval;
+    if (isEmpty == false)
+    {
+        uint32_t first = mapBits;
+        uint32_t previous = 0UL;
+        uint32_t gapStart = 0UL;
+        uint32_t gapLength = 0UL;
+        for (uint32_t bit = 0UL; bit < mapBits; ++bit)
+        {
+            if ((phaseMap[bit >> 5U] & (1UL << (bit & 0x1FUL))) != 0UL)
+            {
+                if (first == mapBits)
+                {
+                    first = bit;
+                }
+                else if ((bit - previous) > gapLength)
+                {
+                    gapStart = previous;
+                    gapLength = bit - previous;
+                }
+                previous = bit;
+            }
+        }
+
+        // The gap after the last phase wraps around to the first one. A single phase is followed by the whole interval.
+        if ((first + mapBits - previous) > gapLength)
+        {
+            gapStart = previous;
+            gapLength = first + mapBits - previous;
+        }
+        phase = ((((2UL * gapStart) + gapLength) * interval) / (2UL * mapBits)) % interval;
+    }
+    return phase;
+}
+
+staticf void Scheduler_AddToWheel(SchedulerTask_t* pTask)
+{
+    uint32_t expires = pTask->expires;
+    uint32_t delta = expires - ticks;
+    SchedulerTask_t** ppSlot;
+
+    if (delta < WHEEL_ROOT_SIZE)
+    {
+        ppSlot = &wheelRoot[expires & WHEEL_ROOT_MASK];
+    }
+    else
+    {
+        if (delta > WHEEL_MAX_DELTA)
+        {
+            delta = WHEEL_MAX_DELTA;
+            expires = ticks + WHEEL_MAX_DELTA;
+        }
+
+        uint32_t level = 0UL;
+        while (delta >= (1UL << WHEEL_LEVEL_SHIFT(level + 1UL)))
+        {
+            ++level;
+        }
+        ppSlot = &wheelLevels[level][(expires >> WHEEL_LEVEL_SHIFT(level)) & WHEEL_LEVEL_MASK];
+    }
+
+    pTask->pNext = *ppSlot;
+    if (pTask->pNext != NULL)
+    {
+        pTask->pNext->ppPrev = &pTask->pNext;
+    }
+    pTask->ppPrev = ppSlot;
+    *ppSlot = pTask;
+    return;
+}
+
+staticf void Scheduler_RemoveFromWheel(SchedulerTask_t* pTask)
+{
+    if (pTask->ppPrev != NULL)
+    {
+        *pTask->ppPrev = pTask->pNext;
+        if (pTask->pNext != NULL)
+        {
+            pTask->pNext->ppPrev = pTask->ppPrev;
+        }
+        pTask->ppPrev = NULL;
+    }
+    return;
+}
+
+staticf void Scheduler_Cascade(uint32_t now)
+{
+    bool isWrapped = true;
+    for (uint32_t level = 0UL; (level < WHEEL_LEVELS) && isWrapped; ++level)
+    {
+        uint32_t index = (now >> WHEEL_LEVEL_SHIFT(level)) & WHEEL_LEVEL_MASK;
+        SchedulerTask_t* pTask = wheelLevels[level][index];
+        wheelLevels[level][index] = NULL;
+
+        while (pTask != NULL)
+        {
+            SchedulerTask_t* pNext = pTask->pNext;
+            Scheduler_AddToWheel(pTask);
+            pTask = pNext;
+        }
+
+        // The next level is cascaded only when this level wraps around.
+        isWrapped = (index == 0UL);
+    }
+    return;
+}
+
+staticf uint32_t Scheduler_ExpireTasks(SchedulerTask_t* pTask)
+{
+    uint32_t count = 0UL;
+    while (pTask != NULL)
+    {
+        ++count;
+        SchedulerTask_t* pNext = pTask->pNext;
+        pTask->ppPrev = NULL;
+
+        // A task that is still waiting for its previous call is not queued twice.
+        if (pTask->isReady)
+        {
+            ++pTask->overruns;
+        }
+        else
+        {
+            Scheduler_PushReady(pTask);
+        }
+
+        // A one-shot task stays out of the wheel until it is started again.
+        if (pTask->interval > 0U)
+        {
+            pTask->expires += pTask->interval;
+            Scheduler_AddToWheel(pTask);
+        }
+        pTask = pNext;
+    }
+    return count;
+}
+
+staticf void Scheduler_PushReady(SchedulerTask_t* pTask)
+{
+    uint32_t priority = pTask->priority;
+    pTask->isReady = true;
+    pTask->pNextReady = NULL;
+    if (readyHeads[priority] == NULL)
+    {
+        readyHeads[priority] = pTask;
+    }
+    else
+    {
+        readyTails[priority]->pNextReady = pTask;
+    }
+    readyTails[priority] = pTask;
+
+    if (priority == 1UL)
+    {
+        // ICSR is a write-one-to-set register, so it must not be read-modified-written.
+        REG_WRITE(SCB->ICSR, SCB_ICSR_PENDSVSET_Msk);
+    }
+    else if (priority > 1UL)
+    {
+        NVIC_SetPendingIRQ(levelIrqs[priority - 1UL]);
+    }
+    return;
+}
+
+staticf bool Scheduler_PopEvent(SchedulerEvent_t* pEvent)
+{
+    uint32_t tail = eventTail;
+    bool isPopped = (eventHead != tail);
+    if (isPopped)
+    {
+        *pEvent = events[tail & EVENT_QUEUE_MASK];
+        // The event must be copied before the producer can reuse the entry.
+        __DMB();
+        eventTail = tail + 1UL;
+    }
+    return isPopped;
+}
+
+staticf void Scheduler_CallTask(SchedulerTask_t* pTask)
+{
+    uint16_t generation = pTask->generation;
+    uint32_t startCycles = REG_READ(DWT->CYCCNT);
+    pTask->Task(pTask->pContext);
+    uint32_t cycles = REG_READ(DWT->CYCCNT) - startCycles;
+
+    // The task may have deleted itself and the entry may already belong to a new task.
+    if (pTask->generation == generation)
+    {
+        ++pTask->calls;
+        pTask->totalCycles += cycles;
+        if (cycles < pTask->minCycles)
+        {
+            pTask->minCycles = cycles;
+        }
+        if (cycles > pTask->maxCycles)
+        {
+            pTask->maxCycles = cycles;
+        }
+    }
+    return;
+}
+
+staticf void Scheduler_DispatchLevel(uint32_t priority)
+{
+    // The higher priorities preempt this loop through their own exceptions, so only this queue is emptied here.
+    SchedulerTask_t* pTask = Scheduler_PopReady(priority);
+    while (pTask != NULL)
+    {
+        if (pTask->Task != NULL)
+        {
+            Scheduler_CallTask(pTask);
+        }
+        pTask = Scheduler_PopReady(priority);
+    }
+    return;
+}
+
+staticf SchedulerTask_t* Scheduler_PopReady(uint32_t priority)
+{
+    ENTER_CRITICAL();
+    SchedulerTask_t* pTask = readyHeads[priority];
+    if (pTask != NULL)
+    {
+        readyHeads[priority] = pTask->pNextReady;
+        pTask->isReady = false;
+    }
+    EXIT_CRITICAL();
+    return pTask;
+}
+
+staticf uint32_t Scheduler_GetIdleTicks(void)
+{
+    uint32_t index = ticks & WHEEL_ROOT_MASK;
+
+    // The tick of the next cascade must be handled even if its root slot is empty.
+    uint32_t limit = WHEEL_ROOT_SIZE - index;
+    uint32_t maxTicks = SysTick_LOAD_RELOAD_Msk / tickCycles;
+    if (limit > maxTicks)
+    {
+        limit = maxTicks;
+    }
+
+    uint32_t idleTicks = 1UL;
+    while ((idleTicks < limit) && (wheelRoot[(index + idleTicks) & WHEEL_ROOT_MASK] == NULL))
+    {
+        ++idleTicks;
+    }
+    return idleTicks;
+}
+
+staticf void Scheduler_Sleep(uint32_t sleepTicks)
+{
+    CLEAR_BIT(SysTick->CTRL, SysTick_CTRL_ENABLE_Pos);
+    if (GET_BIT(SCB->ICSR, SCB_ICSR_PENDSTSET_Pos))
+    {
+        // The tick elapsed while the timer was being stopped.
+        SET_BIT(SysTick->CTRL, SysTick_CTRL_ENABLE_Pos);
+    }
+    else
+    {
+        // The first skipped tick is shortened by the part of the current tick that has already passed.
+        uint32_t remaining = REG_READ(SysTick->VAL);
+        uint32_t sleepCycles = ((remaining > 0UL) ? remaining : 1UL) + ((sleepTicks - 1UL) * tickCycles);
+        REG_WRITE(SysTick->LOAD, sleepCycles - 1UL);
+        REG_WRITE(SysTick->VAL, 0UL);
+        SET_BIT(SysTick->CTRL, SysTick_CTRL_ENABLE_Pos);
+
+        __WFI();
+
+        CLEAR_BIT(SysTick->CTRL, SysTick_CTRL_ENABLE_Pos);
+        uint32_t value = REG_READ(SysTick->VAL);
+        uint32_t skippedTicks;
+        uint32_t nextTickCycles;
+        if (GET_BIT(SCB->ICSR, SCB_ICSR_PENDSTSET_Pos))
+        {
+            // The whole sleep elapsed and the interrupt of the last tick is pending. The counter has been reloaded.
+            skippedTicks = sleepTicks - 1UL;
+            uint32_t overrun = (value > 0UL) ? (sleepCycles - value) : 0UL;
+            nextTickCycles = (overrun < tickCycles) ? (tickCycles - overrun) : 1UL;
+        }
+        else
+        {
+            // Another interrupt woke the CPU up. Tick boundaries are at multiples of the tick period from the end.
+            skippedTicks = (sleepTicks - 1UL) - ((value - 1UL) / tickCycles);
+            nextTickCycles = ((value - 1UL) % tickCycles) + 1UL;
+        }
+        Scheduler_RestartTick(nextTickCycles);
+
+        ticks += skippedTicks;
+        tickLoad.ticks[0] += skippedTicks;
+    }
+    return;
+}
+
+staticf void Scheduler_RestartTick(uint32_t cycles)
+{
+    // A reload value of zero would stop the timer.
+    if (cycles < 2UL)
+    {
+        cycles = 2UL;
+    }
+    REG_WRITE(SysTick->LOAD, cycles - 1UL);
+    REG_WRITE(SysTick->VAL, 0UL);
+    SET_BIT(SysTick->CTRL, SysTick_CTRL_ENABLE_Pos);
+    // The new reload value is taken into use when the shortened tick ends.
+    REG_WRITE(SysTick->LOAD, tickCycles - 1UL);
+    return;
+}
+
+staticf void Scheduler_EnableCycleCounter(void)
+{
+    SET_BIT(CoreDebug->DEMCR, CoreDebug_DEMCR_TRCENA_Pos);
+    REG_WRITE(DWT->CYCCNT, 0UL);
+    SET_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA_Pos);
+    return;
+}
@@ -0,0 +1,19 @@
+add_executable(run_bench_scheduler
+               ${CMAKE_CURRENT_LIST_DIR}/bench_scheduler.cpp
+               ${CMAKE_CURRENT_LIST_DIR}/../../CMSIS/mocks/stm32f429xx_mock.c
+               ${CMAKE_CURRENT_LIST_DIR}/../sources/scheduler.c)
+
+target_include_directories(run_bench_scheduler PUBLIC
+                           "${CMAKE_CURRENT_LIST_DIR}/../../../TestingUtils/FFF"
+                           "${CMAKE_CURRENT_LIST_DIR}/../../CMSIS/include"
+                           "${CMAKE_CURRENT_LIST_DIR}/../../CMSIS/mocks"
+                           "${CMAKE_CURRENT_LIST_DIR}/../../HAL/include"
+                           "${CMAKE_CURRENT_LIST_DIR}/../../HAL/mocks"
+                           "${CMAKE_CURRENT_LIST_DIR}/../../Utils/include"
+                           "${CMAKE_CURRENT_LIST_DIR}/../mocks"
+                           "${CMAKE_CURRENT_LIST_DIR}/../include")
+
+target_compile_definitions(run_bench_scheduler PUBLIC SCHEDULER_MAX_TASKS=1000U)
+target_compile_options(run_bench_scheduler PUBLIC -O2)
+
+add_test(NAME bench_scheduler COMMAND run_bench_scheduler)
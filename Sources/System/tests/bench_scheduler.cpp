@@ -0,0 +1,280 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2020 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    bench_scheduler.cpp
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    17 Oct 2026
+//! 
+//! @brief   This is a host benchmark for the scheduler tick.
+//! 
+//! The benchmark creates 10, 100 and 1000 periodic tasks with intervals between 1 s and 60 s and measures the average
+//! host time of one tick, i.e. SysTick_Handler() followed by Scheduler_Run(). With the timing wheel the tick cost
+//! follows the number of expiring tasks, which stays small, so the cost per tick shall stay roughly flat. The peak load
+//! is the largest number of tasks expiring on one tick, the last histogram bin meaning that many or more.
+//! 
+//! The same task sets are run on a linear scan baseline, which is the earliest deadline check and task table scan of
+//! the scheduler before the timing wheel. Its cost grows with the number of tasks. The benchmark fails if the cost per
+//! tick of the scheduler with 1000 tasks is more than maxCostRatio times the cost with 10 tasks.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <chrono>
+#include <stdio.h>
+#include <fff.h>
+DEFINE_FFF_GLOBALS;
+
+extern "C" {
+#include "scheduler.h"
+#include "utils.h"
+}
+
+// Mocks
+#include "cmsis_mock.h"
+#include "hal_mock.h"
+#include "system_mock.h"
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Benchmark Parameters
+//-----------------------------------------------------------------------------------------------------------------------------
+
+static const uint32_t aTaskCounts[] = {10UL, 100UL, 1000UL};
+static const uint32_t warmUpTicks = 65536UL;
+static const uint32_t measuredTicks = 1048576UL;
+static const uint32_t minInterval = 1000UL;
+static const uint32_t maxInterval = 60000UL;
+static const uint32_t measuredRuns = 3UL;           // The fastest run is used, so that the host load does not count.
+static const double maxCostRatio = 4.0;             // Largest allowed cost per tick of 1000 tasks relative to 10 tasks.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Benchmark Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief A task of the linear scan baseline.
+typedef struct
+{
+    uint32_t nextRun;       //!< Tick of the next call.
+    uint16_t interval;      //!< Task call interval in ticks.
+} BenchScanTask_t;
+
+static uint32_t dispatchedTasks;
+static uint32_t randomState;
+static BenchScanTask_t aScanTasks[1000];
+static uint32_t scanTaskCount;
+static uint32_t scanTicks;
+static uint32_t scanDeadline;
+static bool isScanDispatchPending;
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Helper Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief A benchmark task that only counts its calls.
+/// @param pContext - A pointer to the dispatch counter.
+static void Bench_Task(void* pContext);
+
+/// @brief A deterministic pseudo random generator so that every run uses the same task set.
+/// @return A pseudo random number.
+static uint32_t Bench_Random(void);
+
+/// @brief This function creates the benchmark task set on the scheduler and on the linear scan baseline.
+/// @param taskCount - Number of tasks.
+/// @return Returns true if all tasks were created.
+static bool Bench_CreateTasks(uint32_t taskCount);
+
+/// @brief This function runs the scheduler for given number of ticks.
+/// @param tickCount - Number of ticks to run.
+static void Bench_RunTicks(uint32_t tickCount);
+
+/// @brief This function runs the linear scan baseline for given number of ticks.
+/// @param tickCount - Number of ticks to run.
+static void Bench_RunScanTicks(uint32_t tickCount);
+
+/// @brief This function recalculates the earliest deadline of the linear scan baseline.
+static void Bench_UpdateScanDeadline(void);
+
+/// @brief This function measures the average host time of one tick.
+/// @param RunTicks - A function that runs given number of ticks.
+/// @return Returns the fastest measured time per tick in nanoseconds.
+static double Bench_MeasureTick(void (*RunTicks)(uint32_t tickCount));
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------------------------------------------------------
+
+int main(void)
+{
+    int result = 0;
+    double aWheelCosts[UTILS_ARRAY_LENGTH(aTaskCounts, uint32_t)];
+    double aScanCosts[UTILS_ARRAY_LENGTH(aTaskCounts, uint32_t)];
+    printf("%8s %14s %14s %18s %14s\n", "tasks", "ns per tick", "scan ns/tick", "dispatches/tick", "peak load");
+
+    for (uint32_t run = 0UL; run < UTILS_ARRAY_LENGTH(aTaskCounts, uint32_t); ++run)
+    {
+        uint32_t taskCount = aTaskCounts[run];
+        CMSIS_MOCK_RESET();
+        HAL_MOCK_RESET();
+        SYSTEM_MOCK_RESET();
+        if (Bench_CreateTasks(taskCount) == false)
+        {
+            result = 1;
+        }
+
+        aScanCosts[run] = Bench_MeasureTick(Bench_RunScanTicks);
+        aWheelCosts[run] = Bench_MeasureTick(Bench_RunTicks);
+
+        SchedulerLoad_t load;
+        Scheduler_GetLoad(&load);
+        uint32_t peakLoad = 0UL;
+        for (uint32_t i = 0UL; i < SCHEDULER_LOAD_BINS; ++i)
+        {
+            if (load.ticks[i] != 0UL)
+            {
+                peakLoad = i;
+            }
+        }
+
+        printf("%8u %14.1f %14.1f %18.4f %14u\n", taskCount, aWheelCosts[run], aScanCosts[run],
+               (double)dispatchedTasks / measuredTicks, peakLoad);
+    }
+
+    uint32_t last = UTILS_ARRAY_LENGTH(aTaskCounts, uint32_t) - 1UL;
+    double wheelRatio = aWheelCosts[last] / aWheelCosts[0];
+    double scanRatio = aScanCosts[last] / aScanCosts[0];
+    printf("cost ratio of %u to %u tasks: %.2f, linear scan %.2f, allowed %.2f\n", aTaskCounts[last], aTaskCounts[0],
+           wheelRatio, scanRatio, maxCostRatio);
+    if (wheelRatio > maxCostRatio)
+    {
+        result = 1;
+    }
+    return result;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Helper Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+static void Bench_Task(void* pContext)
+{
+    ++(*(uint32_t*)pContext);
+    return;
+}
+
+static uint32_t Bench_Random(void)
+{
+    randomState = (randomState * 1103515245UL) + 12345UL;
+    return randomState >> 8;
+}
+
+static bool Bench_CreateTasks(uint32_t taskCount)
+{
+    bool isCreated = (Scheduler_Init() == ERROR_OK);
+    randomState = 1UL;
+    scanTaskCount = taskCount;
+    scanTicks = 0UL;
+    for (uint32_t i = 0UL; i < taskCount; ++i)
+    {
+        TaskConfig_t config =
+        {
+            .Task = Bench_Task,
+            .pContext = &dispatchedTasks,
+            .interval = (uint16_t)(minInterval + (Bench_Random() % (maxInterval - minInterval)))
+        };
+        TaskHandle_t handle;
+        if (Scheduler_CreateTask(&config, &handle) != ERROR_OK)
+        {
+            isCreated = false;
+        }
+        aScanTasks[i] = {.nextRun = config.interval, .interval = config.interval};
+    }
+    Bench_UpdateScanDeadline();
+    return isCreated;
+}
+
+static void Bench_RunTicks(uint32_t tickCount)
+{
+    for (uint32_t i = 0UL; i < tickCount; ++i)
+    {
+        SysTick_Handler();
+        Scheduler_Run();
+    }
+    return;
+}
+
+static void Bench_RunScanTicks(uint32_t tickCount)
+{
+    for (uint32_t i = 0UL; i < tickCount; ++i)
+    {
+        uint32_t now = ++scanTicks;
+        if ((int32_t)(now - scanDeadline) >= 0)
+        {
+            isScanDispatchPending = true;
+        }
+
+        if (isScanDispatchPending)
+        {
+            isScanDispatchPending = false;
+            for (uint32_t j = 0UL; j < scanTaskCount; ++j)
+            {
+                BenchScanTask_t* pTask = &aScanTasks[j];
+                if ((int32_t)(now - pTask->nextRun) >= 0)
+                {
+                    pTask->nextRun += pTask->interval;
+                    Bench_Task(&dispatchedTasks);
+                }
+            }
+            Bench_UpdateScanDeadline();
+        }
+    }
+    return;
+}
+
+static void Bench_UpdateScanDeadline(void)
+{
+    uint32_t earliest = scanTicks + UINT16_MAX;
+    for (uint32_t i = 0UL; i < scanTaskCount; ++i)
+    {
+        if ((int32_t)(aScanTasks[i].nextRun - earliest) < 0)
+        {
+            earliest = aScanTasks[i].nextRun;
+        }
+    }
+    scanDeadline = earliest;
+    return;
+}
+
+static double Bench_MeasureTick(void (*RunTicks)(uint32_t tickCount))
+{
+    RunTicks(warmUpTicks);
+    double fastest = 0.0;
+    for (uint32_t run = 0UL; run < measuredRuns; ++run)
+    {
+        dispatchedTasks = 0UL;
+        auto start = std::chrono::steady_clock::now();
+        RunTicks(measuredTicks);
+        auto end = std::chrono::steady_clock::now();
+        double nanoseconds = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        if ((run == 0UL) || (nanoseconds < fastest))
+        {
+            fastest = nanoseconds;
+        }
+    }
+    return fastest / measuredTicks;
+}
@@ -0,0 +1,14 @@
+add_executable(run_utest_schedulability
+               ${CMAKE_CURRENT_LIST_DIR}/utest_schedulability.cpp
+               ${CMAKE_CURRENT_LIST_DIR}/../../../TestingUtils/Helpers/utest_helpers.cpp
+               ${CMAKE_CURRENT_LIST_DIR}/../sources/schedulability.c)
+
+target_include_directories(run_utest_schedulability PUBLIC
+                           "${CMAKE_CURRENT_LIST_DIR}/../../../TestingUtils/Catch2"
+                           "${CMAKE_CURRENT_LIST_DIR}/../../../TestingUtils/FFF"
+                           "${CMAKE_CURRENT_LIST_DIR}/../../../TestingUtils/Helpers"
+                           "${CMAKE_CURRENT_LIST_DIR}/../../Utils/include"
+                           "${CMAKE_CURRENT_LIST_DIR}/../mocks"
+                           "${CMAKE_CURRENT_LIST_DIR}/../include")
+
+catch_discover_tests(run_utest_schedulability)
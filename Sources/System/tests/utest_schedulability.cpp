@@ -0,0 +1,283 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2020 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    utest_schedulability.cpp
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    17 Oct 2026
+//! 
+//! @brief   These are unit tests for schedulability.c
+//! 
+//! These are unit tests for schedulability.c utilizing Catch2 and FFF.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#define CATCH_CONFIG_RUNNER
+#include <catch_utils.hpp>
+#include <fff.h>
+DEFINE_FFF_GLOBALS;
+#include "utest_helpers.hpp"
+
+extern "C" {
+#include "schedulability.h"
+#include "scheduler.h"
+}
+
+// Mocks
+#include "system_mock.h"
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    UTestHelper::InitRandom();
+    int result = Catch::Session().run(argc, argv);
+    return result;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Test Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+static const uint8_t interruptPriority = SCHEDULER_PRIORITY_LEVELS;
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Helper Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief This helper function creates a task for the analysis.
+/// @param period - Task period.
+/// @param wcet - Task worst-case execution time.
+/// @param priority - Task priority.
+/// @return Returns the task with no results.
+static SchedulabilityTask_t Helper_Task(uint32_t period, uint32_t wcet, uint8_t priority);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Test Cases
+//-----------------------------------------------------------------------------------------------------------------------------
+
+SCENARIO ("Interrupt handlers are analysed", "[schedulability]")
+{
+    INIT_MOCKS();
+    SYSTEM_MOCK_RESET();
+
+    GIVEN ("three interrupt handlers of different priorities")
+    {
+        SchedulabilityTask_t tasks[] =
+        {
+            Helper_Task(7UL, 3UL, interruptPriority + 2U),
+            Helper_Task(12UL, 3UL, interruptPriority + 1U),
+            Helper_Task(20UL, 5UL, interruptPriority)
+        };
+
+        WHEN ("the task set is analysed")
+        {
+            Error_t error = Schedulability_Analyse(tasks, ARRAY_LENGTH(tasks, SchedulabilityTask_t));
+
+            THEN ("no errors shall occur")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (NO_ASSERT_ERRORS);
+
+                AND_THEN ("the handlers shall be preempted by the higher priority handlers only")
+                {
+                    REQUIRE (tasks[0].response == 3UL);
+                    REQUIRE (tasks[1].response == 6UL);
+                    REQUIRE (tasks[2].response == 20UL);
+
+                    AND_THEN ("a response time equal to the deadline shall be schedulable")
+                    {
+                        REQUIRE (tasks[0].isSchedulable);
+                        REQUIRE (tasks[1].isSchedulable);
+                        REQUIRE (tasks[2].isSchedulable);
+                    }
+                }
+            }
+        }
+    }
+
+    GIVEN ("two interrupt handlers that overload the CPU")
+    {
+        SchedulabilityTask_t tasks[] =
+        {
+            Helper_Task(4UL, 3UL, interruptPriority + 1U),
+            Helper_Task(10UL, 3UL, interruptPriority)
+        };
+
+        WHEN ("the task set is analysed")
+        {
+            Error_t error = Schedulability_Analyse(tasks, ARRAY_LENGTH(tasks, SchedulabilityTask_t));
+
+            THEN ("the lower priority handler shall miss its deadline")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (tasks[0].isSchedulable);
+                REQUIRE (tasks[1].isSchedulable == false);
+                REQUIRE (tasks[1].response == 12UL);
+            }
+        }
+    }
+}
+
+SCENARIO ("Tasks are analysed", "[schedulability]")
+{
+    INIT_MOCKS();
+    SYSTEM_MOCK_RESET();
+
+    GIVEN ("two main loop tasks")
+    {
+        SchedulabilityTask_t tasks[] =
+        {
+            Helper_Task(10UL, 2UL, 0U),
+            Helper_Task(20UL, 3UL, 0U)
+        };
+
+        WHEN ("the task set is analysed")
+        {
+            Error_t error = Schedulability_Analyse(tasks, ARRAY_LENGTH(tasks, SchedulabilityTask_t));
+
+            THEN ("the tasks shall wait for their own previous call and for each other")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (tasks[0].response == 7UL);
+                REQUIRE (tasks[1].response == 8UL);
+                REQUIRE (tasks[0].isSchedulable);
+                REQUIRE (tasks[1].isSchedulable);
+            }
+        }
+    }
+
+    GIVEN ("two preemptive tasks of different priorities")
+    {
+        SchedulabilityTask_t tasks[] =
+        {
+            Helper_Task(10UL, 2UL, 2U),
+            Helper_Task(50UL, 6UL, 1U)
+        };
+
+        WHEN ("the task set is analysed")
+        {
+            Error_t error = Schedulability_Analyse(tasks, ARRAY_LENGTH(tasks, SchedulabilityTask_t));
+
+            THEN ("the higher priority task shall preempt the lower priority task instead of being blocked by it")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (tasks[0].response == 4UL);
+                REQUIRE (tasks[1].response == 16UL);
+                REQUIRE (tasks[0].isSchedulable);
+                REQUIRE (tasks[1].isSchedulable);
+            }
+        }
+    }
+
+    GIVEN ("a main loop task, a priority 1 task and an interrupt handler")
+    {
+        SchedulabilityTask_t tasks[] =
+        {
+            Helper_Task(100UL, 10UL, 0U),
+            Helper_Task(20UL, 5UL, 1U),
+            Helper_Task(10UL, 1UL, interruptPriority)
+        };
+
+        WHEN ("the task set is analysed")
+        {
+            Error_t error = Schedulability_Analyse(tasks, ARRAY_LENGTH(tasks, SchedulabilityTask_t));
+
+            THEN ("each task shall be preempted by the higher dispatch levels")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (tasks[0].response == 34UL);
+                REQUIRE (tasks[1].response == 12UL);
+                REQUIRE (tasks[2].response == 1UL);
+                REQUIRE (tasks[0].isSchedulable);
+                REQUIRE (tasks[1].isSchedulable);
+                REQUIRE (tasks[2].isSchedulable);
+            }
+        }
+
+        WHEN ("the main loop task is analysed with a deadline shorter than the preemptions")
+        {
+            tasks[0].period = 30UL;
+            Error_t error = Schedulability_Analyse(tasks, ARRAY_LENGTH(tasks, SchedulabilityTask_t));
+
+            THEN ("the main loop task shall miss its deadline")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (tasks[0].isSchedulable == false);
+                REQUIRE (tasks[0].response > 30UL);
+                REQUIRE (tasks[1].isSchedulable);
+            }
+        }
+    }
+}
+
+SCENARIO ("Analysis fails", "[schedulability][error_handling]")
+{
+    INIT_MOCKS();
+    SYSTEM_MOCK_RESET();
+
+    GIVEN ("a task with zero period")
+    {
+        SchedulabilityTask_t tasks[] =
+        {
+            Helper_Task(10UL, 1UL, 0U),
+            Helper_Task(0UL, 1UL, 0U)
+        };
+
+        WHEN ("the task set is analysed")
+        {
+            Error_t error = Schedulability_Analyse(tasks, ARRAY_LENGTH(tasks, SchedulabilityTask_t));
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(SCHEDULER_FAILURE));
+            }
+        }
+    }
+
+    GIVEN ("no task set")
+    {
+        WHEN ("the task set is analysed")
+        {
+            Error_t error = Schedulability_Analyse(NULL, 1UL);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(SCHEDULER_FAILURE));
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Helper Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+static SchedulabilityTask_t Helper_Task(uint32_t period, uint32_t wcet, uint8_t priority)
+{
+    SchedulabilityTask_t task = {.period = period, .wcet = wcet, .priority = priority, .response = 0UL, .isSchedulable = false};
+    return task;
+}
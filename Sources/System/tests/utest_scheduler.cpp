@@ -0,0 +1,2283 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2020 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    utest_scheduler.cpp
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    17 Oct 2026
+//! 
+//! @brief   These are unit tests for scheduler.c
+//! 
+//! These are unit tests for scheduler.c utilizing Catch2 and FFF.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#define CATCH_CONFIG_RUNNER
+#include <catch_utils.hpp>
+#include <fff.h>
+DEFINE_FFF_GLOBALS;
+#include "utest_helpers.hpp"
+
+extern "C" {
+#include "coroutine.h"
+#include "scheduler.h"
+}
+
+// Mocks
+#include "cmsis_mock.h"
+#include "hal_mock.h"
+#include "system_mock.h"
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    UTestHelper::InitRandom();
+    int result = Catch::Session().run(argc, argv);
+    return result;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Statics of UUT
+//-----------------------------------------------------------------------------------------------------------------------------
+
+extern "C" {
+
+extern void* volatile readyHeads[SCHEDULER_PRIORITY_LEVELS];
+extern volatile uint32_t ticks;
+extern volatile uint32_t maxTickCycles;
+extern SchedulerLoad_t tickLoad;
+
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Test Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief A call record of a recording test task.
+typedef struct
+{
+    uint32_t interval;  //!< Task interval.
+    uint32_t startTick; //!< Tick when the task was created.
+    uint32_t calls;     //!< Number of calls.
+    uint32_t lastTick;  //!< Tick of the last call relative to startTick.
+    uint32_t errors;    //!< Number of calls that did not happen on a deadline.
+} Recording_t;
+
+/// @brief A call record of a timer test task.
+typedef struct
+{
+    uint32_t calls;     //!< Number of calls.
+    uint32_t lastTick;  //!< Tick of the last call.
+} TimerRecord_t;
+
+/// @brief A context of the test coroutine task.
+typedef struct
+{
+    Coroutine_t coroutine;  //!< Coroutine state.
+    bool isEventSet;        //!< A flag set by the test to emulate an interrupt event.
+    uint32_t steps;         //!< Number of steps completed.
+} CoroutineContext_t;
+
+/// @brief A virtual CPU clock and SysTick timer for the tickless idle tests.
+typedef struct
+{
+    uint64_t cycles;            //!< CPU cycles since the start.
+    uint64_t wakeUpPeriod;      //!< Period of an external wake-up interrupt in cycles. 0 if not used.
+    uint64_t nextWakeUp;        //!< Cycle of the next external wake-up interrupt.
+    bool isEnabled;             //!< SysTick enable bit.
+    bool isPending;             //!< SysTick interrupt pending bit.
+    uint32_t load;              //!< SysTick reload value.
+    uint32_t value;             //!< SysTick current value.
+    uint32_t interrupts;        //!< Number of SysTick interrupts.
+    uint32_t sleeps;            //!< Number of WFI calls.
+} VirtualTime_t;
+
+static VirtualTime_t virtualTime;
+static bool isVirtualTimeChecked;
+
+static uint32_t cycleCounter;
+static uint32_t busyCycles;
+
+static const uint32_t maxHandledEvents = 32UL;
+static uint32_t handledEvents[maxHandledEvents];
+static uint32_t handledEventCount;
+
+static int taskACalls;
+static int taskBCalls;
+static TaskHandle_t handleA;
+static TaskHandle_t handleB;
+
+static uint32_t firstCallTicks[4];
+
+static const uint32_t maxCallOrder = 8UL;
+static uint32_t callOrder[maxCallOrder];
+static uint32_t callOrderCount;
+static uint32_t blockedTicks;
+
+static CoroutineContext_t coroutineContext;
+static TimerRecord_t timerRecord;
+
+static const uint32_t maxRecordingTasks = 16UL;
+static Recording_t recordings[maxRecordingTasks];
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Helper Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief A test task that counts its calls.
+/// @param pContext - A pointer to the call counter.
+static void Helper_CountingTask(void* pContext);
+
+/// @brief A test task that records its call ticks and checks them against its interval.
+/// @param pContext - A pointer to the call record.
+static void Helper_RecordingTask(void* pContext);
+
+/// @brief A test task that advances the cycle counter by a given number of cycles.
+/// @param pContext - A pointer to the number of cycles.
+static void Helper_BusyTask(void* pContext);
+
+/// @brief A test event handler that records the event data.
+/// @param pContext - The posted context. Expected to point to taskACalls.
+/// @param data - Event data.
+static void Helper_EventHandler(void* pContext, uint32_t data);
+
+/// @brief A test task that records the tick of its first call.
+/// @param pContext - A pointer to the first call tick. Must be zero initially.
+static void Helper_FirstCallTask(void* pContext);
+
+/// @brief A test task that counts its calls and records the tick of the last call.
+/// @param pContext - A pointer to the timer record.
+static void Helper_TimerTask(void* pContext);
+
+/// @brief A test task that records its identifier in the call order.
+/// @param pContext - A pointer to the task identifier.
+static void Helper_OrderTask(void* pContext);
+
+/// @brief A test task that blocks the main loop while the ticks and the preemptive tasks go on.
+/// @param pContext - A pointer to the number of ticks to block.
+static void Helper_BlockingTask(void* pContext);
+
+/// @brief A priority 1 test task that blocks while the ticks and the tasks of priority 2 and 3 go on. The exceptions of
+/// the higher priorities are taken as the NVIC would take them while the task runs.
+/// @param pContext - A pointer to the number of ticks to block.
+static void Helper_PreemptedTask(void* pContext);
+
+/// @brief A test coroutine task that completes a step, waits for an event, completes a step, yields for one call and
+/// completes a step.
+/// @param pContext - A pointer to the coroutine context.
+static void Helper_CoroutineTask(void* pContext);
+
+/// @brief This helper function initialises the scheduler on a virtual SysTick timer.
+/// @param wakeUpPeriod - Period of an external wake-up interrupt in cycles. 0 disables the wake-ups.
+static void Helper_InitVirtualTime(uint64_t wakeUpPeriod);
+
+/// @brief This helper function runs the main loop with tickless idle on virtual time.
+/// @param tickCount - Number of ticks to run.
+static void Helper_RunVirtualTime(uint32_t tickCount);
+
+/// @brief This helper function advances the virtual clock and takes the SysTick interrupts that occur.
+/// @param cycles - Number of cycles to advance.
+static void Helper_ExecuteVirtualCycles(uint64_t cycles);
+
+/// @brief This helper function advances the virtual clock at most to the next SysTick wrap.
+/// @param cycles - Number of cycles to advance.
+/// @return Returns the number of cycles advanced.
+static uint64_t Helper_AdvanceVirtualClock(uint64_t cycles);
+
+/// @brief This helper function creates a task.
+/// @param Task - A task function.
+/// @param pContext - A task context.
+/// @param interval - Task interval.
+/// @param pHandle - A pointer where the task handle is stored.
+/// @return Returns the error code of Scheduler_CreateTask().
+static Error_t Helper_CreateTask(Task_t Task, void* pContext, uint16_t interval, TaskHandle_t* pHandle);
+
+/// @brief This helper function creates a task of given priority.
+/// @param Task - A task function.
+/// @param pContext - A task context.
+/// @param interval - Task interval.
+/// @param priority - Task priority.
+/// @param pHandle - A pointer where the task handle is stored.
+/// @return Returns the error code of Scheduler_CreateTask().
+static Error_t Helper_CreatePriorityTask(Task_t Task, void* pContext, uint16_t interval, uint8_t priority,
+                                         TaskHandle_t* pHandle);
+
+/// @brief This helper function creates a recording task for each given interval.
+/// @param pIntervals - An array of task intervals.
+/// @param count - Number of intervals.
+static void Helper_CreateRecordingTasks(const uint16_t* pIntervals, size_t count);
+
+/// @brief This helper function initialises the scheduler with all mocks reset.
+static void Helper_InitScheduler(void);
+
+/// @brief This helper function advances the scheduler by given number of ticks and runs due tasks after each tick. The
+/// preemptive tasks are run right after the tick as their dispatch exceptions would run them.
+/// @param tickCount - Number of ticks to advance.
+static void Helper_AdvanceTicks(uint32_t tickCount);
+
+/// @brief This helper function takes the dispatch exceptions of the preemptive tasks, highest priority first, as the NVIC
+/// would take them when they are pending together.
+static void Helper_TakeDispatchExceptions(void);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Custom Fake Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+/// @brief A custom fake of REG_READ() that reads the cycle counter advanced by Helper_BusyTask().
+static uint32_t REG_READ_CycleCounterFake(uint32_t* pRegister);
+
+/// @brief A custom fake of REG_READ() that reads the virtual SysTick and DWT cycle counter.
+static uint32_t REG_READ_CustomFake(uint32_t* pRegister);
+
+/// @brief A custom fake of REG_WRITE() that writes the virtual SysTick.
+static void REG_WRITE_CustomFake(uint32_t* pRegister, uint32_t value);
+
+/// @brief A custom fake of SET_BIT() that enables the virtual SysTick.
+static void SET_BIT_CustomFake(uint32_t* pRegister, uint32_t bit);
+
+/// @brief A custom fake of CLEAR_BIT() that disables the virtual SysTick.
+static void CLEAR_BIT_CustomFake(uint32_t* pRegister, uint32_t bit);
+
+/// @brief A custom fake of GET_BIT() that reads the virtual SysTick pending bit.
+static bool GET_BIT_CustomFake(uint32_t* pRegister, uint32_t bit);
+
+/// @brief A custom fake of SysTick_Config() that starts the virtual SysTick.
+static uint32_t SysTick_Config_CustomFake(uint32_t ticks);
+
+/// @brief A custom fake of __WFI() that advances the virtual clock to the next interrupt.
+static void __WFI_CustomFake(void);
+
+/// @brief A custom fake of __set_PRIMASK() that takes a pending SysTick interrupt when interrupts are enabled.
+static void __set_PRIMASK_CustomFake(uint32_t priMask);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Test Cases
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//------------------------------------
+// Scheduler_Init
+//------------------------------------
+
+SCENARIO ("Scheduler is initialised", "[scheduler]")
+{
+    INIT_MOCKS();
+    CMSIS_MOCK_RESET();
+    HAL_MOCK_RESET();
+    SYSTEM_MOCK_RESET();
+
+    GIVEN ("the scheduler has some random state")
+    {
+        ticks = (uint32_t)UTestHelper::GetRandomInt(1, 100000);
+        maxTickCycles = (uint32_t)UTestHelper::GetRandomInt(1, 100000);
+        tickLoad.ticks[0] = (uint32_t)UTestHelper::GetRandomInt(1, 100000);
+        tickLoad.ticks[SCHEDULER_LOAD_BINS - 1U] = (uint32_t)UTestHelper::GetRandomInt(1, 100000);
+
+        WHEN ("the scheduler is initialised")
+        {
+            Error_t error = Scheduler_Init();
+
+            THEN ("no errors shall occur")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (NO_ASSERT_ERRORS);
+
+                AND_THEN ("the state shall be reset")
+                {
+                    REQUIRE (ticks == 0UL);
+                    REQUIRE (readyHeads[0] == nullptr);
+                    REQUIRE (maxTickCycles == 0UL);
+                    REQUIRE (tickLoad.ticks[0] == 0UL);
+                    REQUIRE (tickLoad.ticks[SCHEDULER_LOAD_BINS - 1U] == 0UL);
+
+                    AND_THEN ("the DWT cycle counter shall be enabled")
+                    {
+                        REQUIRE (MOCK_NEXT_CALLED_FUNCTION_IS(SET_BIT_MOCK));
+                        REQUIRE (MOCK_ARG_HISTORY(SET_BIT_MOCK, 0, 0) == &CoreDebug->DEMCR);
+                        REQUIRE (MOCK_ARG_HISTORY(SET_BIT_MOCK, 1, 0) == CoreDebug_DEMCR_TRCENA_Pos);
+                        REQUIRE (MOCK_NEXT_CALLED_FUNCTION_IS(REG_WRITE_MOCK));
+                        REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 0, 0) == &DWT->CYCCNT);
+                        REQUIRE (MOCK_ARG_HISTORY(REG_WRITE_MOCK, 1, 0) == 0UL);
+                        REQUIRE (MOCK_NEXT_CALLED_FUNCTION_IS(SET_BIT_MOCK));
+                        REQUIRE (MOCK_ARG_HISTORY(SET_BIT_MOCK, 0, 1) == &DWT->CTRL);
+                        REQUIRE (MOCK_ARG_HISTORY(SET_BIT_MOCK, 1, 1) == DWT_CTRL_CYCCNTENA_Pos);
+
+                        AND_THEN ("SysTick shall be configured to 1 ms")
+                        {
+                            REQUIRE (MOCK_NEXT_CALLED_FUNCTION_IS(SysTick_Config));
+                            REQUIRE (MOCK_CALLS(SysTick_Config) == 1);
+                            REQUIRE (MOCK_LAST_ARG(SysTick_Config, 0) == SystemCoreClock / 1000UL);
+
+                            AND_THEN ("all priority bits shall be preemption priority bits")
+                            {
+                                REQUIRE (MOCK_NEXT_CALLED_FUNCTION_IS(NVIC_SetPriorityGrouping));
+                                REQUIRE (MOCK_LAST_ARG(NVIC_SetPriorityGrouping, 0) == 3UL);
+
+                                AND_THEN ("the dispatch exceptions shall have rising priorities below SysTick")
+                                {
+                                    REQUIRE (MOCK_CALLS(NVIC_EncodePriority) == 4);
+                                    REQUIRE (MOCK_ARG_HISTORY(NVIC_EncodePriority, 0, 0) == 3UL);
+                                    REQUIRE (MOCK_ARG_HISTORY(NVIC_EncodePriority, 1, 0) == 12UL);
+                                    REQUIRE (MOCK_ARG_HISTORY(NVIC_EncodePriority, 0, 1) == 3UL);
+                                    REQUIRE (MOCK_ARG_HISTORY(NVIC_EncodePriority, 1, 1) == 15UL);
+                                    REQUIRE (MOCK_ARG_HISTORY(NVIC_EncodePriority, 0, 2) == 3UL);
+                                    REQUIRE (MOCK_ARG_HISTORY(NVIC_EncodePriority, 1, 2) == 14UL);
+                                    REQUIRE (MOCK_ARG_HISTORY(NVIC_EncodePriority, 0, 3) == 3UL);
+                                    REQUIRE (MOCK_ARG_HISTORY(NVIC_EncodePriority, 1, 3) == 13UL);
+                                    REQUIRE (MOCK_CALLS(NVIC_SetPriority) == 4);
+                                    REQUIRE (MOCK_ARG_HISTORY(NVIC_SetPriority, 0, 0) == SysTick_IRQn);
+                                    REQUIRE (MOCK_ARG_HISTORY(NVIC_SetPriority, 0, 1) == PendSV_IRQn);
+                                    REQUIRE (MOCK_ARG_HISTORY(NVIC_SetPriority, 0, 2) == UART7_IRQn);
+                                    REQUIRE (MOCK_ARG_HISTORY(NVIC_SetPriority, 0, 3) == UART8_IRQn);
+
+                                    AND_THEN ("the software triggered vectors shall be enabled")
+                                    {
+                                        REQUIRE (MOCK_CALLS(NVIC_EnableIRQ) == 2);
+                                        REQUIRE (MOCK_ARG_HISTORY(NVIC_EnableIRQ, 0, 0) == UART7_IRQn);
+                                        REQUIRE (MOCK_ARG_HISTORY(NVIC_EnableIRQ, 0, 1) == UART8_IRQn);
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("Scheduler initialisation fails", "[scheduler][error_handling]")
+{
+    INIT_MOCKS();
+    CMSIS_MOCK_RESET();
+    HAL_MOCK_RESET();
+    SYSTEM_MOCK_RESET();
+
+    GIVEN ("SysTick_Config() fails")
+    {
+        MOCK_SET_RETURN_VALUE(SysTick_Config, 1UL);
+
+        WHEN ("the scheduler is initialised")
+        {
+            Error_t error = Scheduler_Init();
+
+            THEN ("a peripheral failure shall occur")
+            {
+                REQUIRE (error == ERROR_PERIPHERAL_FAILURE);
+            }
+        }
+    }
+}
+
+//------------------------------------
+// Scheduler_CreateTask
+//------------------------------------
+
+SCENARIO ("Task is created", "[scheduler]")
+{
+    GIVEN ("the scheduler is initialised")
+    {
+        Helper_InitScheduler();
+
+        WHEN ("a task is created")
+        {
+            uint16_t interval = (uint16_t)UTestHelper::GetRandomInt(1, 1000);
+            Error_t error = Helper_CreateTask(Helper_CountingTask, &taskACalls, interval, &handleA);
+
+            THEN ("no errors shall occur")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (NO_ASSERT_ERRORS);
+
+                AND_THEN ("the wheel shall be updated with interrupts disabled")
+                {
+                    REQUIRE (MOCK_CALLS(__disable_irq) == 1);
+                    REQUIRE (MOCK_CALLS(__set_PRIMASK) == 1);
+
+                    AND_THEN ("the task shall be called one interval later")
+                    {
+                        Helper_AdvanceTicks((uint32_t)interval - 1UL);
+                        REQUIRE (taskACalls == 0);
+                        Helper_AdvanceTicks(1UL);
+                        REQUIRE (taskACalls == 1);
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("Task creation fails", "[scheduler][error_handling]")
+{
+    GIVEN ("the scheduler is initialised")
+    {
+        Helper_InitScheduler();
+
+        WHEN ("a task is created without a configuration")
+        {
+            Error_t error = Scheduler_CreateTask(NULL, &handleA);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(SCHEDULER_FAILURE));
+            }
+        }
+
+        WHEN ("a task is created without a handle pointer")
+        {
+            const TaskConfig_t config = {.Task = Helper_CountingTask, .pContext = &taskACalls, .interval = 100U};
+            Error_t error = Scheduler_CreateTask(&config, NULL);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(SCHEDULER_FAILURE));
+            }
+        }
+
+        WHEN ("a null task is created")
+        {
+            Error_t error = Helper_CreateTask(NULL, NULL, 100U, &handleA);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(SCHEDULER_FAILURE));
+            }
+        }
+
+        WHEN ("a task with zero interval is created")
+        {
+            Error_t error = Helper_CreateTask(Helper_CountingTask, &taskACalls, 0U, &handleA);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(SCHEDULER_FAILURE));
+            }
+        }
+
+        WHEN ("a task with too high priority is created")
+        {
+            Error_t error = Helper_CreatePriorityTask(Helper_CountingTask, &taskACalls, 100U,
+                                                      (uint8_t)SCHEDULER_PRIORITY_LEVELS, &handleA);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(SCHEDULER_FAILURE));
+            }
+        }
+
+        AND_GIVEN ("the task table is full")
+        {
+            Error_t error = ERROR_OK;
+            while (error == ERROR_OK)
+            {
+                error = Helper_CreateTask(Helper_CountingTask, &taskACalls, 100U, &handleA);
+            }
+
+            THEN ("not enough resources error shall occur")
+            {
+                REQUIRE (error == ERROR_NOT_ENOUGH_RESOURCES);
+                REQUIRE (NO_ASSERT_ERRORS);
+            }
+        }
+    }
+}
+
+//------------------------------------
+// Scheduler_DeleteTask
+//------------------------------------
+
+SCENARIO ("Task is deleted", "[scheduler]")
+{
+    GIVEN ("two tasks are running")
+    {
+        Helper_InitScheduler();
+        REQUIRE (Helper_CreateTask(Helper_CountingTask, &taskACalls, 10U, &handleA) == ERROR_OK);
+        REQUIRE (Helper_CreateTask(Helper_CountingTask, &taskBCalls, 10U, &handleB) == ERROR_OK);
+
+        WHEN ("the first task is deleted")
+        {
+            Error_t error = Scheduler_DeleteTask(handleA);
+
+            THEN ("no errors shall occur")
+            {
+                REQUIRE (error == ERROR_OK);
+
+                AND_THEN ("only the second task shall be called")
+                {
+                    Helper_AdvanceTicks(100UL);
+                    REQUIRE (taskACalls == 0);
+                    REQUIRE (taskBCalls == 10);
+                }
+            }
+        }
+    }
+
+    GIVEN ("a task is deleted while it is waiting in the ready queue")
+    {
+        Helper_InitScheduler();
+        REQUIRE (Helper_CreateTask(Helper_CountingTask, &taskACalls, 10U, &handleA) == ERROR_OK);
+        for (uint32_t i = 0UL; i < 10UL; ++i)
+        {
+            SysTick_Handler();
+        }
+        REQUIRE (readyHeads[0] != nullptr);
+        REQUIRE (Scheduler_DeleteTask(handleA) == ERROR_OK);
+
+        WHEN ("the main loop runs")
+        {
+            Scheduler_Run();
+
+            THEN ("the deleted task shall not be called")
+            {
+                REQUIRE (taskACalls == 0);
+                REQUIRE (readyHeads[0] == nullptr);
+            }
+        }
+    }
+}
+
+SCENARIO ("Same task function runs with different contexts", "[scheduler]")
+{
+    GIVEN ("one task function is created twice with different contexts")
+    {
+        Helper_InitScheduler();
+        REQUIRE (Helper_CreateTask(Helper_CountingTask, &taskACalls, 10U, &handleA) == ERROR_OK);
+        REQUIRE (Helper_CreateTask(Helper_CountingTask, &taskBCalls, 25U, &handleB) == ERROR_OK);
+
+        THEN ("the handles shall differ")
+        {
+            REQUIRE (handleA != handleB);
+        }
+
+        WHEN ("100 ticks pass")
+        {
+            Helper_AdvanceTicks(100UL);
+
+            THEN ("each context shall be updated on its own interval")
+            {
+                REQUIRE (taskACalls == 10);
+                REQUIRE (taskBCalls == 4);
+
+                AND_WHEN ("the second task is deleted by its handle")
+                {
+                    REQUIRE (Scheduler_DeleteTask(handleB) == ERROR_OK);
+                    Helper_AdvanceTicks(100UL);
+
+                    THEN ("only the first context shall be updated")
+                    {
+                        REQUIRE (taskACalls == 20);
+                        REQUIRE (taskBCalls == 4);
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("Task deletion fails", "[scheduler][error_handling]")
+{
+    GIVEN ("one task is running")
+    {
+        Helper_InitScheduler();
+        REQUIRE (Helper_CreateTask(Helper_CountingTask, &taskACalls, 10U, &handleA) == ERROR_OK);
+
+        WHEN ("a handle beyond the task table is deleted")
+        {
+            Error_t error = Scheduler_DeleteTask(handleA | 0xFFFFUL);
+
+            THEN ("an invalid action error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+            }
+        }
+
+        WHEN ("a handle of an unused entry is deleted")
+        {
+            Error_t error = Scheduler_DeleteTask(handleA + 1UL);
+
+            THEN ("an invalid action error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+            }
+        }
+
+        WHEN ("the task is deleted twice")
+        {
+            REQUIRE (Scheduler_DeleteTask(handleA) == ERROR_OK);
+            Error_t error = Scheduler_DeleteTask(handleA);
+
+            THEN ("an invalid action error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+            }
+        }
+
+        WHEN ("the task is deleted and its entry is reused by another task")
+        {
+            REQUIRE (Scheduler_DeleteTask(handleA) == ERROR_OK);
+            REQUIRE (Helper_CreateTask(Helper_CountingTask, &taskBCalls, 10U, &handleB) == ERROR_OK);
+            Error_t error = Scheduler_DeleteTask(handleA);
+
+            THEN ("the stale handle shall be rejected")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+
+                AND_THEN ("the new task shall keep running")
+                {
+                    Helper_AdvanceTicks(10UL);
+                    REQUIRE (taskBCalls == 1);
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------
+// Scheduler_Run and SysTick_Handler
+//------------------------------------
+
+SCENARIO ("Tasks are dispatched on their intervals", "[scheduler]")
+{
+    GIVEN ("a 100 ms task and a 30 ms task are running")
+    {
+        Helper_InitScheduler();
+        REQUIRE (Helper_CreateTask(Helper_CountingTask, &taskACalls, 100U, &handleA) == ERROR_OK);
+        REQUIRE (Helper_CreateTask(Helper_CountingTask, &taskBCalls, 30U, &handleB) == ERROR_OK);
+
+        WHEN ("99 ticks have passed")
+        {
+            Helper_AdvanceTicks(99UL);
+
+            THEN ("only the 30 ms task shall have been called")
+            {
+                REQUIRE (taskACalls == 0);
+                REQUIRE (taskBCalls == 3);
+
+                AND_WHEN ("one more tick passes")
+                {
+                    Helper_AdvanceTicks(1UL);
+
+                    THEN ("the 100 ms task shall be called")
+                    {
+                        REQUIRE (taskACalls == 1);
+                        REQUIRE (taskBCalls == 3);
+                    }
+                }
+            }
+        }
+
+        WHEN ("the main loop is blocked for 250 ticks")
+        {
+            for (uint32_t i = 0UL; i < 250UL; ++i)
+            {
+                SysTick_Handler();
+            }
+            Scheduler_Run();
+
+            THEN ("both tasks shall be called only once")
+            {
+                REQUIRE (taskACalls == 1);
+                REQUIRE (taskBCalls == 1);
+
+                AND_THEN ("the schedule shall keep its original phase")
+                {
+                    Helper_AdvanceTicks(19UL);
+                    REQUIRE (taskBCalls == 1);
+                    Helper_AdvanceTicks(1UL);
+                    REQUIRE (taskBCalls == 2);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("Idle ticks do not request a dispatch", "[scheduler]")
+{
+    GIVEN ("a 100 ms task is running")
+    {
+        Helper_InitScheduler();
+        REQUIRE (Helper_CreateTask(Helper_CountingTask, &taskACalls, 100U, &handleA) == ERROR_OK);
+
+        WHEN ("ticks pass without reaching the deadline")
+        {
+            for (uint32_t i = 0UL; i < 99UL; ++i)
+            {
+                SysTick_Handler();
+            }
+
+            THEN ("no dispatch shall be pending")
+            {
+                REQUIRE (ticks == 99UL);
+                REQUIRE (readyHeads[0] == nullptr);
+
+                AND_WHEN ("the deadline is reached")
+                {
+                    SysTick_Handler();
+
+                    THEN ("a dispatch shall be pending")
+                    {
+                        REQUIRE (readyHeads[0] != nullptr);
+                        REQUIRE (Scheduler_GetTicks() == 100UL);
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("Long interval tasks are cascaded down the wheel", "[scheduler]")
+{
+    GIVEN ("tasks with intervals on every level of the wheel are running")
+    {
+        Helper_InitScheduler();
+        const uint16_t aIntervals[] = {1U, 255U, 256U, 257U, 16383U, 16384U, 16385U, 40000U, 65535U};
+        Helper_CreateRecordingTasks(aIntervals, ARRAY_LENGTH(aIntervals, uint16_t));
+
+        WHEN ("the scheduler runs for 200000 ticks")
+        {
+            Helper_AdvanceTicks(200000UL);
+
+            THEN ("every task shall be called exactly on its deadlines")
+            {
+                for (size_t i = 0U; i < ARRAY_LENGTH(aIntervals, uint16_t); ++i)
+                {
+                    uint32_t expectedCalls = 200000UL / aIntervals[i];
+                    REQUIRE (recordings[i].calls == expectedCalls);
+                    REQUIRE (recordings[i].lastTick == expectedCalls * aIntervals[i]);
+                    REQUIRE (recordings[i].errors == 0UL);
+                }
+            }
+        }
+    }
+
+    GIVEN ("tasks are created when the tick counter is about to wrap around")
+    {
+        Helper_InitScheduler();
+        ticks = 0xFFFFFF00UL;
+        const uint16_t aIntervals[] = {100U, 300U, 5000U, 20000U};
+        Helper_CreateRecordingTasks(aIntervals, ARRAY_LENGTH(aIntervals, uint16_t));
+
+        WHEN ("the scheduler runs over the wrap-around")
+        {
+            Helper_AdvanceTicks(100000UL);
+
+            THEN ("every task shall be called exactly on its deadlines")
+            {
+                for (size_t i = 0U; i < ARRAY_LENGTH(aIntervals, uint16_t); ++i)
+                {
+                    REQUIRE (recordings[i].calls == 100000UL / aIntervals[i]);
+                    REQUIRE (recordings[i].errors == 0UL);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("Tasks of the same interval are staggered", "[scheduler]")
+{
+    GIVEN ("the scheduler is initialised")
+    {
+        Helper_InitScheduler();
+        for (uint32_t i = 0UL; i < ARRAY_LENGTH(firstCallTicks, uint32_t); ++i)
+        {
+            firstCallTicks[i] = 0UL;
+        }
+
+        WHEN ("four 100 ms tasks are created without a phase")
+        {
+            TaskHandle_t handle;
+            for (uint32_t i = 0UL; i < ARRAY_LENGTH(firstCallTicks, uint32_t); ++i)
+            {
+                REQUIRE (Helper_CreateTask(Helper_FirstCallTask, &firstCallTicks[i], 100U, &handle) == ERROR_OK);
+            }
+            Helper_AdvanceTicks(1000UL);
+
+            THEN ("each task shall be placed in the middle of the largest free gap")
+            {
+                REQUIRE (firstCallTicks[0] == 100UL);
+                REQUIRE (firstCallTicks[1] == 50UL);
+                REQUIRE (firstCallTicks[2] == 25UL);
+                REQUIRE (firstCallTicks[3] == 75UL);
+
+                AND_THEN ("no tick shall expire more than one task")
+                {
+                    SchedulerLoad_t load;
+                    Scheduler_GetLoad(&load);
+                    REQUIRE (load.ticks[0] == 960UL);
+                    REQUIRE (load.ticks[1] == 40UL);
+                    for (uint32_t i = 2UL; i < SCHEDULER_LOAD_BINS; ++i)
+                    {
+                        REQUIRE (load.ticks[i] == 0UL);
+                    }
+                }
+            }
+        }
+
+        WHEN ("four 100 ms tasks are created with the same explicit phase")
+        {
+            TaskHandle_t handle;
+            for (uint32_t i = 0UL; i < ARRAY_LENGTH(firstCallTicks, uint32_t); ++i)
+            {
+                const TaskConfig_t config =
+                {
+                    .Task = Helper_FirstCallTask,
+                    .pContext = &firstCallTicks[i],
+                    .interval = 100U,
+                    .phase = 30U
+                };
+                REQUIRE (Scheduler_CreateTask(&config, &handle) == ERROR_OK);
+            }
+            Helper_AdvanceTicks(1000UL);
+
+            THEN ("all tasks shall be first called after the phase")
+            {
+                for (uint32_t i = 0UL; i < ARRAY_LENGTH(firstCallTicks, uint32_t); ++i)
+                {
+                    REQUIRE (firstCallTicks[i] == 30UL);
+                }
+
+                AND_THEN ("the tasks shall expire on the same ticks")
+                {
+                    SchedulerLoad_t load;
+                    Scheduler_GetLoad(&load);
+                    REQUIRE (load.ticks[0] == 990UL);
+                    REQUIRE (load.ticks[1] == 0UL);
+                    REQUIRE (load.ticks[4] == 10UL);
+                }
+            }
+        }
+    }
+
+    GIVEN ("the scheduler is initialised and a 1000 ms task exists")
+    {
+        Helper_InitScheduler();
+        firstCallTicks[0] = 0UL;
+        firstCallTicks[1] = 0UL;
+        TaskHandle_t handle;
+        REQUIRE (Helper_CreateTask(Helper_FirstCallTask, &firstCallTicks[0], 1000U, &handle) == ERROR_OK);
+
+        WHEN ("another 1000 ms task is created without a phase 10 ticks later")
+        {
+            Helper_AdvanceTicks(10UL);
+            REQUIRE (Helper_CreateTask(Helper_FirstCallTask, &firstCallTicks[1], 1000U, &handle) == ERROR_OK);
+            Helper_AdvanceTicks(1000UL);
+
+            THEN ("the task shall be placed half an interval from the existing one")
+            {
+                REQUIRE (firstCallTicks[0] == 1000UL);
+                REQUIRE (firstCallTicks[1] == 500UL);
+            }
+        }
+    }
+
+    GIVEN ("tasks of different intervals are created")
+    {
+        Helper_InitScheduler();
+        REQUIRE (Helper_CreateTask(Helper_CountingTask, &taskACalls, 100U, &handleA) == ERROR_OK);
+        REQUIRE (Helper_CreateTask(Helper_CountingTask, &taskBCalls, 50U, &handleB) == ERROR_OK);
+
+        WHEN ("100 ticks pass")
+        {
+            Helper_AdvanceTicks(100UL);
+
+            THEN ("the tasks shall keep their interval phase")
+            {
+                REQUIRE (taskACalls == 1);
+                REQUIRE (taskBCalls == 2);
+            }
+        }
+    }
+}
+
+SCENARIO ("Higher priority tasks preempt the main loop", "[scheduler]")
+{
+    GIVEN ("a main loop task and a priority 1 task of the same interval")
+    {
+        Helper_InitScheduler();
+        REQUIRE (Helper_CreatePriorityTask(Helper_CountingTask, &taskACalls, 10U, 0U, &handleA) == ERROR_OK);
+        REQUIRE (Helper_CreatePriorityTask(Helper_CountingTask, &taskBCalls, 10U, 1U, &handleB) == ERROR_OK);
+
+        WHEN ("the tasks expire")
+        {
+            HAL_MOCK_RESET();
+            for (uint32_t i = 0UL; i < 10UL; ++i)
+            {
+                SysTick_Handler();
+            }
+
+            THEN ("PendSV shall be requested")
+            {
+                REQUIRE (MOCK_CALLS(REG_WRITE_MOCK) == 1);
+                REQUIRE (MOCK_LAST_ARG(REG_WRITE_MOCK, 0) == &SCB->ICSR);
+                REQUIRE (MOCK_LAST_ARG(REG_WRITE_MOCK, 1) == SCB_ICSR_PENDSVSET_Msk);
+
+                AND_WHEN ("the main loop runs")
+                {
+                    Scheduler_Run();
+
+                    THEN ("only the main loop task shall be called")
+                    {
+                        REQUIRE (taskACalls == 1);
+                        REQUIRE (taskBCalls == 0);
+
+                        AND_WHEN ("PendSV is taken")
+                        {
+                            PendSV_Handler();
+
+                            THEN ("the priority task shall be called")
+                            {
+                                REQUIRE (taskACalls == 1);
+                                REQUIRE (taskBCalls == 1);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    GIVEN ("priority 2 and 3 tasks of the same interval")
+    {
+        Helper_InitScheduler();
+        REQUIRE (Helper_CreatePriorityTask(Helper_CountingTask, &taskACalls, 10U, 2U, &handleA) == ERROR_OK);
+        REQUIRE (Helper_CreatePriorityTask(Helper_CountingTask, &taskBCalls, 10U, 3U, &handleB) == ERROR_OK);
+
+        WHEN ("the tasks expire")
+        {
+            CMSIS_MOCK_RESET();
+            HAL_MOCK_RESET();
+            for (uint32_t i = 0UL; i < 10UL; ++i)
+            {
+                SysTick_Handler();
+            }
+
+            THEN ("the dispatch exception of each priority shall be pended instead of PendSV")
+            {
+                REQUIRE (MOCK_CALLS(REG_WRITE_MOCK) == 0);
+                REQUIRE (MOCK_CALLS(NVIC_SetPendingIRQ) == 2);
+                REQUIRE (((MOCK_ARG_HISTORY(NVIC_SetPendingIRQ, 0, 0) == UART7_IRQn) ||
+                          (MOCK_ARG_HISTORY(NVIC_SetPendingIRQ, 0, 1) == UART7_IRQn)));
+                REQUIRE (((MOCK_ARG_HISTORY(NVIC_SetPendingIRQ, 0, 0) == UART8_IRQn) ||
+                          (MOCK_ARG_HISTORY(NVIC_SetPendingIRQ, 0, 1) == UART8_IRQn)));
+
+                AND_WHEN ("the priority 3 exception is taken")
+                {
+                    UART8_IRQHandler();
+
+                    THEN ("only the priority 3 task shall be called")
+                    {
+                        REQUIRE (taskACalls == 0);
+                        REQUIRE (taskBCalls == 1);
+
+                        AND_WHEN ("the priority 2 exception is taken")
+                        {
+                            UART7_IRQHandler();
+
+                            THEN ("the priority 2 task shall be called")
+                            {
+                                REQUIRE (taskACalls == 1);
+                                REQUIRE (taskBCalls == 1);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    GIVEN ("priority 1 and 3 tasks expire on the same tick")
+    {
+        Helper_InitScheduler();
+        static uint32_t lowId = 1UL;
+        static uint32_t highId = 3UL;
+        REQUIRE (Helper_CreatePriorityTask(Helper_OrderTask, &lowId, 10U, 1U, &handleA) == ERROR_OK);
+        REQUIRE (Helper_CreatePriorityTask(Helper_OrderTask, &highId, 10U, 3U, &handleB) == ERROR_OK);
+
+        WHEN ("the pending dispatch exceptions are taken")
+        {
+            for (uint32_t i = 0UL; i < 10UL; ++i)
+            {
+                SysTick_Handler();
+            }
+            Helper_TakeDispatchExceptions();
+
+            THEN ("the higher priority task shall be called first")
+            {
+                REQUIRE (callOrderCount == 2UL);
+                REQUIRE (callOrder[0] == 3UL);
+                REQUIRE (callOrder[1] == 1UL);
+            }
+        }
+    }
+
+    GIVEN ("a 1 ms priority task and a main loop task that blocks for 20 ticks")
+    {
+        Helper_InitScheduler();
+        blockedTicks = 20UL;
+        REQUIRE (Helper_CreatePriorityTask(Helper_BlockingTask, &blockedTicks, 100U, 0U, &handleA) == ERROR_OK);
+        REQUIRE (Helper_CreatePriorityTask(Helper_CountingTask, &taskBCalls, 1U, 1U, &handleB) == ERROR_OK);
+
+        WHEN ("the main loop task is called")
+        {
+            Helper_AdvanceTicks(100UL);
+
+            THEN ("the priority task shall be called on every tick while the main loop is blocked")
+            {
+                REQUIRE (Scheduler_GetTicks() == 120UL);
+                REQUIRE (taskBCalls == 120);
+
+                TaskStats_t stats;
+                REQUIRE (Scheduler_GetTaskStats(handleB, &stats) == ERROR_OK);
+                REQUIRE (stats.overruns == 0UL);
+            }
+        }
+    }
+
+    GIVEN ("a 1 ms priority 3 task and a priority 1 task that blocks for 20 ticks")
+    {
+        Helper_InitScheduler();
+        blockedTicks = 20UL;
+        REQUIRE (Helper_CreatePriorityTask(Helper_PreemptedTask, &blockedTicks, 100U, 1U, &handleA) == ERROR_OK);
+        REQUIRE (Helper_CreatePriorityTask(Helper_CountingTask, &taskBCalls, 1U, 3U, &handleB) == ERROR_OK);
+
+        WHEN ("the priority 1 task is called")
+        {
+            Helper_AdvanceTicks(100UL);
+
+            THEN ("the priority 3 task shall preempt it on every tick")
+            {
+                REQUIRE (Scheduler_GetTicks() == 120UL);
+                REQUIRE (taskBCalls == 120);
+
+                TaskStats_t stats;
+                REQUIRE (Scheduler_GetTaskStats(handleB, &stats) == ERROR_OK);
+                REQUIRE (stats.overruns == 0UL);
+                REQUIRE (Scheduler_GetTaskStats(handleA, &stats) == ERROR_OK);
+                REQUIRE (stats.calls == 1UL);
+            }
+        }
+    }
+}
+
+SCENARIO ("Tick load is read", "[scheduler]")
+{
+    GIVEN ("the scheduler is initialised")
+    {
+        Helper_InitScheduler();
+
+        WHEN ("a number of tasks larger than the histogram expires on one tick")
+        {
+            for (uint32_t i = 0UL; i < SCHEDULER_LOAD_BINS + 2UL; ++i)
+            {
+                const TaskConfig_t config =
+                {
+                    .Task = Helper_CountingTask,
+                    .pContext = &taskACalls,
+                    .interval = 10U,
+                    .phase = 10U
+                };
+                TaskHandle_t handle;
+                REQUIRE (Scheduler_CreateTask(&config, &handle) == ERROR_OK);
+            }
+            Helper_AdvanceTicks(10UL);
+
+            THEN ("the tick shall be counted in the last bin")
+            {
+                SchedulerLoad_t load;
+                Scheduler_GetLoad(&load);
+                REQUIRE (load.ticks[0] == 9UL);
+                REQUIRE (load.ticks[SCHEDULER_LOAD_BINS - 1U] == 1UL);
+            }
+        }
+    }
+}
+
+SCENARIO ("Tick load read fails", "[scheduler][error_handling]")
+{
+    GIVEN ("the scheduler is initialised")
+    {
+        Helper_InitScheduler();
+
+        WHEN ("the load is read without a destination")
+        {
+            Scheduler_GetLoad(NULL);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(SCHEDULER_FAILURE));
+            }
+        }
+    }
+}
+
+//------------------------------------
+// Scheduler_CreateOneShot and timers
+//------------------------------------
+
+SCENARIO ("One-shot task is called once per start", "[scheduler]")
+{
+    GIVEN ("a one-shot task is created without a phase")
+    {
+        Helper_InitScheduler();
+        timerRecord = {};
+        const TaskConfig_t config = {.Task = Helper_TimerTask, .pContext = &timerRecord};
+        Error_t error = Scheduler_CreateOneShot(&config, &handleA);
+        REQUIRE (error == ERROR_OK);
+        REQUIRE (NO_ASSERT_ERRORS);
+
+        WHEN ("ticks pass")
+        {
+            Helper_AdvanceTicks(1000UL);
+
+            THEN ("the task shall not be called")
+            {
+                REQUIRE (timerRecord.calls == 0UL);
+            }
+        }
+
+        WHEN ("the timer is started with a 50 ms delay")
+        {
+            Helper_AdvanceTicks(10UL);
+            REQUIRE (Scheduler_StartTimer(handleA, 50UL) == ERROR_OK);
+            Helper_AdvanceTicks(1000UL);
+
+            THEN ("the task shall be called once after the delay")
+            {
+                REQUIRE (timerRecord.calls == 1UL);
+                REQUIRE (timerRecord.lastTick == 60UL);
+
+                AND_WHEN ("the timer is started again with the same handle")
+                {
+                    REQUIRE (Scheduler_StartTimer(handleA, 300UL) == ERROR_OK);
+                    Helper_AdvanceTicks(1000UL);
+
+                    THEN ("the task shall be called once more")
+                    {
+                        REQUIRE (timerRecord.calls == 2UL);
+                        REQUIRE (timerRecord.lastTick == 1310UL);
+                    }
+                }
+            }
+        }
+
+        WHEN ("the timer is restarted before it expires")
+        {
+            REQUIRE (Scheduler_StartTimer(handleA, 50UL) == ERROR_OK);
+            Helper_AdvanceTicks(40UL);
+            REQUIRE (Scheduler_StartTimer(handleA, 50UL) == ERROR_OK);
+            Helper_AdvanceTicks(100UL);
+
+            THEN ("the call shall be postponed")
+            {
+                REQUIRE (timerRecord.calls == 1UL);
+                REQUIRE (timerRecord.lastTick == 90UL);
+            }
+        }
+
+        WHEN ("the timer is stopped before it expires")
+        {
+            REQUIRE (Scheduler_StartTimer(handleA, 50UL) == ERROR_OK);
+            Helper_AdvanceTicks(20UL);
+            REQUIRE (Scheduler_StopTimer(handleA) == ERROR_OK);
+            Helper_AdvanceTicks(100UL);
+
+            THEN ("the task shall not be called")
+            {
+                REQUIRE (timerRecord.calls == 0UL);
+            }
+        }
+
+        WHEN ("the timer is started with a delay beyond the root level of the wheel")
+        {
+            REQUIRE (Scheduler_StartTimer(handleA, 100000UL) == ERROR_OK);
+            Helper_AdvanceTicks(200000UL);
+
+            THEN ("the task shall be called exactly after the delay")
+            {
+                REQUIRE (timerRecord.calls == 1UL);
+                REQUIRE (timerRecord.lastTick == 100000UL);
+            }
+        }
+    }
+
+    GIVEN ("a one-shot task is created with a phase")
+    {
+        Helper_InitScheduler();
+        timerRecord = {};
+        const TaskConfig_t config = {.Task = Helper_TimerTask, .pContext = &timerRecord, .interval = 10U, .phase = 30U};
+        REQUIRE (Scheduler_CreateOneShot(&config, &handleA) == ERROR_OK);
+
+        WHEN ("ticks pass")
+        {
+            Helper_AdvanceTicks(1000UL);
+
+            THEN ("the task shall be called once after the phase regardless of the interval")
+            {
+                REQUIRE (timerRecord.calls == 1UL);
+                REQUIRE (timerRecord.lastTick == 30UL);
+            }
+        }
+    }
+}
+
+SCENARIO ("Timer is started on an absolute deadline", "[scheduler]")
+{
+    GIVEN ("a one-shot task is created")
+    {
+        Helper_InitScheduler();
+        timerRecord = {};
+        const TaskConfig_t config = {.Task = Helper_TimerTask, .pContext = &timerRecord};
+        REQUIRE (Scheduler_CreateOneShot(&config, &handleA) == ERROR_OK);
+        Helper_AdvanceTicks(100UL);
+
+        WHEN ("the timer is started on a future tick")
+        {
+            REQUIRE (Scheduler_StartTimerAt(handleA, 1234UL) == ERROR_OK);
+            Helper_AdvanceTicks(2000UL);
+
+            THEN ("the task shall be called on that tick")
+            {
+                REQUIRE (timerRecord.calls == 1UL);
+                REQUIRE (timerRecord.lastTick == 1234UL);
+            }
+        }
+
+        WHEN ("the timer is started on a tick that has passed")
+        {
+            REQUIRE (Scheduler_StartTimerAt(handleA, 50UL) == ERROR_OK);
+            Helper_AdvanceTicks(1000UL);
+
+            THEN ("the task shall be called on the next tick")
+            {
+                REQUIRE (timerRecord.calls == 1UL);
+                REQUIRE (timerRecord.lastTick == 101UL);
+            }
+        }
+    }
+
+    GIVEN ("a 100 ms periodic task is running")
+    {
+        Helper_InitScheduler();
+        timerRecord = {};
+        REQUIRE (Helper_CreateTask(Helper_TimerTask, &timerRecord, 100U, &handleA) == ERROR_OK);
+
+        WHEN ("the timer of the task is started on a deadline")
+        {
+            REQUIRE (Scheduler_StartTimerAt(handleA, 250UL) == ERROR_OK);
+            Helper_AdvanceTicks(400UL);
+
+            THEN ("the task shall continue on its interval from the deadline")
+            {
+                REQUIRE (timerRecord.calls == 2UL);
+                REQUIRE (timerRecord.lastTick == 350UL);
+            }
+        }
+
+        WHEN ("the timer of the task is stopped")
+        {
+            REQUIRE (Scheduler_StopTimer(handleA) == ERROR_OK);
+            Helper_AdvanceTicks(1000UL);
+
+            THEN ("the task shall not be called")
+            {
+                REQUIRE (timerRecord.calls == 0UL);
+            }
+        }
+    }
+}
+
+SCENARIO ("Timer use fails", "[scheduler][error_handling]")
+{
+    GIVEN ("the scheduler is initialised")
+    {
+        Helper_InitScheduler();
+
+        WHEN ("a one-shot task is created without a configuration")
+        {
+            Error_t error = Scheduler_CreateOneShot(NULL, &handleA);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(SCHEDULER_FAILURE));
+            }
+        }
+
+        WHEN ("a one-shot task is created without a handle pointer")
+        {
+            const TaskConfig_t config = {.Task = Helper_TimerTask, .pContext = &timerRecord};
+            Error_t error = Scheduler_CreateOneShot(&config, NULL);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(SCHEDULER_FAILURE));
+            }
+        }
+
+        WHEN ("a null one-shot task is created")
+        {
+            const TaskConfig_t config = {.Task = NULL};
+            Error_t error = Scheduler_CreateOneShot(&config, &handleA);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(SCHEDULER_FAILURE));
+            }
+        }
+
+        AND_GIVEN ("the task table is full")
+        {
+            Error_t error = ERROR_OK;
+            const TaskConfig_t config = {.Task = Helper_TimerTask, .pContext = &timerRecord};
+            while (error == ERROR_OK)
+            {
+                error = Scheduler_CreateOneShot(&config, &handleA);
+            }
+
+            THEN ("not enough resources error shall occur")
+            {
+                REQUIRE (error == ERROR_NOT_ENOUGH_RESOURCES);
+                REQUIRE (NO_ASSERT_ERRORS);
+            }
+        }
+
+        AND_GIVEN ("a one-shot task has been created")
+        {
+            const TaskConfig_t config = {.Task = Helper_TimerTask, .pContext = &timerRecord};
+            REQUIRE (Scheduler_CreateOneShot(&config, &handleA) == ERROR_OK);
+
+            WHEN ("the timer is started with zero delay")
+            {
+                Error_t error = Scheduler_StartTimer(handleA, 0UL);
+
+                THEN ("assert error shall occur")
+                {
+                    REQUIRE (error == ERROR_INVALID_ACTION);
+                    REQUIRE (ASSERT_ERROR);
+                    REQUIRE (ASSERT_ERROR_TYPE_IS(SCHEDULER_FAILURE));
+                }
+            }
+
+            WHEN ("the task has been deleted")
+            {
+                REQUIRE (Scheduler_DeleteTask(handleA) == ERROR_OK);
+
+                THEN ("the timer shall not be started or stopped")
+                {
+                    REQUIRE (Scheduler_StartTimer(handleA, 10UL) == ERROR_INVALID_ACTION);
+                    REQUIRE (Scheduler_StartTimerAt(handleA, 10UL) == ERROR_INVALID_ACTION);
+                    REQUIRE (Scheduler_StopTimer(handleA) == ERROR_INVALID_ACTION);
+                    REQUIRE (NO_ASSERT_ERRORS);
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------
+// Scheduler_ResumeTask
+//------------------------------------
+
+SCENARIO ("Task is resumed", "[scheduler]")
+{
+    GIVEN ("a 100 ms task is running")
+    {
+        Helper_InitScheduler();
+        REQUIRE (Helper_CreateTask(Helper_CountingTask, &taskACalls, 100U, &handleA) == ERROR_OK);
+        Helper_AdvanceTicks(10UL);
+
+        WHEN ("the task is resumed twice before the main loop runs")
+        {
+            REQUIRE (Scheduler_ResumeTask(handleA) == ERROR_OK);
+            REQUIRE (Scheduler_ResumeTask(handleA) == ERROR_OK);
+            Scheduler_Run();
+
+            THEN ("the task shall be called once without waiting for its interval")
+            {
+                REQUIRE (taskACalls == 1);
+                REQUIRE (Scheduler_GetTicks() == 10UL);
+
+                AND_THEN ("the task shall keep its interval")
+                {
+                    Helper_AdvanceTicks(89UL);
+                    REQUIRE (taskACalls == 1);
+                    Helper_AdvanceTicks(1UL);
+                    REQUIRE (taskACalls == 2);
+                }
+            }
+        }
+    }
+
+    GIVEN ("a coroutine task is waiting for an event")
+    {
+        Helper_InitScheduler();
+        coroutineContext = {};
+        REQUIRE (Helper_CreateTask(Helper_CoroutineTask, &coroutineContext, 100U, &handleA) == ERROR_OK);
+        Helper_AdvanceTicks(100UL);
+        REQUIRE (coroutineContext.steps == 1UL);
+
+        WHEN ("the interval passes without the event")
+        {
+            Helper_AdvanceTicks(100UL);
+
+            THEN ("the coroutine shall keep waiting")
+            {
+                REQUIRE (coroutineContext.steps == 1UL);
+            }
+        }
+
+        WHEN ("the event resumes the coroutine")
+        {
+            coroutineContext.isEventSet = true;
+            REQUIRE (Scheduler_ResumeTask(handleA) == ERROR_OK);
+            Scheduler_Run();
+
+            THEN ("the coroutine shall continue from the wait until the next yield")
+            {
+                REQUIRE (coroutineContext.steps == 2UL);
+                REQUIRE (coroutineContext.isEventSet == false);
+
+                AND_WHEN ("the task is called twice on its interval")
+                {
+                    Helper_AdvanceTicks(200UL);
+
+                    THEN ("the coroutine shall continue after the yield, end and start again from the beginning")
+                    {
+                        REQUIRE (coroutineContext.steps == 4UL);
+                        REQUIRE (coroutineContext.coroutine.resumeLine != 0U);
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("Task resuming fails", "[scheduler][error_handling]")
+{
+    GIVEN ("a task has been deleted")
+    {
+        Helper_InitScheduler();
+        REQUIRE (Helper_CreateTask(Helper_CountingTask, &taskACalls, 10U, &handleA) == ERROR_OK);
+        REQUIRE (Scheduler_DeleteTask(handleA) == ERROR_OK);
+
+        WHEN ("the task is resumed")
+        {
+            Error_t error = Scheduler_ResumeTask(handleA);
+
+            THEN ("an invalid action error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+
+                AND_THEN ("nothing shall be queued")
+                {
+                    REQUIRE (readyHeads[0] == nullptr);
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------
+// Scheduler_Idle
+//------------------------------------
+
+SCENARIO ("Idle CPU sleeps until the next deadline", "[scheduler]")
+{
+    GIVEN ("tasks are running on virtual time")
+    {
+        Helper_InitVirtualTime(0UL);
+        const uint16_t aIntervals[] = {7U, 100U, 333U, 1000U, 5000U};
+        Helper_CreateRecordingTasks(aIntervals, ARRAY_LENGTH(aIntervals, uint16_t));
+
+        WHEN ("the main loop idles for 20 seconds")
+        {
+            Helper_RunVirtualTime(20000UL);
+
+            THEN ("every task shall be called exactly on its deadlines")
+            {
+                for (size_t i = 0U; i < ARRAY_LENGTH(aIntervals, uint16_t); ++i)
+                {
+                    REQUIRE (recordings[i].calls == 20000UL / aIntervals[i]);
+                    REQUIRE (recordings[i].errors == 0UL);
+                }
+
+                AND_THEN ("the tick count shall follow the real time")
+                {
+                    REQUIRE (Scheduler_GetTicks() == (uint32_t)(virtualTime.cycles / (SystemCoreClock / 1000UL)));
+
+                    AND_THEN ("only the ticks with work shall have interrupted")
+                    {
+                        REQUIRE (virtualTime.interrupts < (Scheduler_GetTicks() / 6UL));
+                        REQUIRE (NO_ASSERT_ERRORS);
+                    }
+                }
+            }
+        }
+    }
+
+    GIVEN ("no tasks are running on virtual time")
+    {
+        Helper_InitVirtualTime(0UL);
+
+        WHEN ("the main loop idles for 10 seconds")
+        {
+            Helper_RunVirtualTime(10000UL);
+
+            THEN ("the CPU shall wake up only for the wheel cascades")
+            {
+                REQUIRE (Scheduler_GetTicks() == (uint32_t)(virtualTime.cycles / (SystemCoreClock / 1000UL)));
+                REQUIRE (virtualTime.interrupts == Scheduler_GetTicks() / 256UL);
+
+                AND_THEN ("the skipped ticks shall be counted as idle load")
+                {
+                    SchedulerLoad_t load;
+                    Scheduler_GetLoad(&load);
+                    REQUIRE (load.ticks[0] == Scheduler_GetTicks());
+                }
+            }
+        }
+    }
+
+    GIVEN ("tasks are running on virtual time and another interrupt wakes the CPU up often")
+    {
+        Helper_InitVirtualTime(7919UL);
+        const uint16_t aIntervals[] = {7U, 100U, 333U, 1000U, 5000U};
+        Helper_CreateRecordingTasks(aIntervals, ARRAY_LENGTH(aIntervals, uint16_t));
+
+        WHEN ("the main loop idles for 20 seconds")
+        {
+            Helper_RunVirtualTime(20000UL);
+
+            THEN ("every task shall still be called exactly on its deadlines")
+            {
+                for (size_t i = 0U; i < ARRAY_LENGTH(aIntervals, uint16_t); ++i)
+                {
+                    REQUIRE (recordings[i].calls == 20000UL / aIntervals[i]);
+                    REQUIRE (recordings[i].errors == 0UL);
+                }
+                REQUIRE (Scheduler_GetTicks() == (uint32_t)(virtualTime.cycles / (SystemCoreClock / 1000UL)));
+            }
+        }
+    }
+}
+
+SCENARIO ("Idle returns when there is work", "[scheduler]")
+{
+    GIVEN ("a task is waiting in the ready queue")
+    {
+        Helper_InitScheduler();
+        REQUIRE (Helper_CreateTask(Helper_CountingTask, &taskACalls, 1U, &handleA) == ERROR_OK);
+        SysTick_Handler();
+        REQUIRE (readyHeads[0] != nullptr);
+        HAL_MOCK_RESET();
+        CMSIS_MOCK_RESET();
+
+        WHEN ("the main loop idles")
+        {
+            Scheduler_Idle();
+
+            THEN ("the CPU shall not sleep and SysTick shall not be touched")
+            {
+                REQUIRE (MOCK_CALLS(__WFI) == 0);
+                REQUIRE (MOCK_CALLS(REG_WRITE_MOCK) == 0);
+                REQUIRE (MOCK_CALLS(__set_PRIMASK) == 1);
+            }
+        }
+    }
+
+    GIVEN ("a tick interrupt is already pending")
+    {
+        Helper_InitScheduler();
+        REQUIRE (Helper_CreateTask(Helper_CountingTask, &taskACalls, 100U, &handleA) == ERROR_OK);
+        HAL_MOCK_RESET();
+        CMSIS_MOCK_RESET();
+        MOCK_SET_RETURN_VALUE(GET_BIT_MOCK, true);
+
+        WHEN ("the main loop idles")
+        {
+            Scheduler_Idle();
+
+            THEN ("the CPU shall wait for the tick without reprogramming SysTick")
+            {
+                REQUIRE (MOCK_ARG_HISTORY(GET_BIT_MOCK, 0, 0) == &SCB->ICSR);
+                REQUIRE (MOCK_ARG_HISTORY(GET_BIT_MOCK, 1, 0) == SCB_ICSR_PENDSTSET_Pos);
+                REQUIRE (MOCK_CALLS(__WFI) == 1);
+                REQUIRE (MOCK_CALLS(REG_WRITE_MOCK) == 0);
+            }
+        }
+    }
+}
+
+//------------------------------------
+// Scheduler_PostEvent
+//------------------------------------
+
+SCENARIO ("Events are deferred to task context", "[scheduler]")
+{
+    GIVEN ("the scheduler is initialised")
+    {
+        Helper_InitScheduler();
+        handledEventCount = 0UL;
+
+        WHEN ("three events are posted")
+        {
+            Error_t aErrors[3];
+            for (uint32_t i = 0UL; i < 3UL; ++i)
+            {
+                aErrors[i] = Scheduler_PostEvent(Helper_EventHandler, &taskACalls, 100UL + i);
+            }
+
+            THEN ("no errors shall occur and the events shall not be handled yet")
+            {
+                for (Error_t error : aErrors)
+                {
+                    REQUIRE (error == ERROR_OK);
+                }
+                REQUIRE (handledEventCount == 0UL);
+
+                AND_THEN ("each event shall be completed before it is published")
+                {
+                    REQUIRE (MOCK_CALLS(__DMB) == 3);
+                    REQUIRE (MOCK_CALLS(__disable_irq) == 0);
+                }
+
+                AND_WHEN ("the main loop runs")
+                {
+                    Scheduler_Run();
+
+                    THEN ("the events shall be handled in the posting order")
+                    {
+                        REQUIRE (handledEventCount == 3UL);
+                        REQUIRE (handledEvents[0] == 100UL);
+                        REQUIRE (handledEvents[1] == 101UL);
+                        REQUIRE (handledEvents[2] == 102UL);
+                    }
+                }
+
+                AND_WHEN ("the main loop idles")
+                {
+                    Scheduler_Idle();
+
+                    THEN ("the CPU shall not sleep")
+                    {
+                        REQUIRE (MOCK_CALLS(__WFI) == 0);
+                    }
+                }
+            }
+        }
+
+        WHEN ("events are posted and handled many times around the queue")
+        {
+            for (uint32_t i = 0UL; i < 100UL; ++i)
+            {
+                REQUIRE (Scheduler_PostEvent(Helper_EventHandler, &taskACalls, i) == ERROR_OK);
+                REQUIRE (Scheduler_PostEvent(Helper_EventHandler, &taskACalls, i) == ERROR_OK);
+                Scheduler_Run();
+                REQUIRE (handledEventCount == 2UL);
+                handledEventCount = 0UL;
+            }
+
+            THEN ("no errors shall occur")
+            {
+                REQUIRE (NO_ASSERT_ERRORS);
+            }
+        }
+    }
+}
+
+SCENARIO ("Event posting fails", "[scheduler][error_handling]")
+{
+    GIVEN ("the scheduler is initialised")
+    {
+        Helper_InitScheduler();
+        handledEventCount = 0UL;
+
+        WHEN ("an event is posted without a handler")
+        {
+            Error_t error = Scheduler_PostEvent(NULL, NULL, 0UL);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(SCHEDULER_FAILURE));
+            }
+        }
+
+        AND_GIVEN ("the event queue is full")
+        {
+            Error_t error = ERROR_OK;
+            uint32_t postedEvents = 0UL;
+            while (error == ERROR_OK)
+            {
+                error = Scheduler_PostEvent(Helper_EventHandler, &taskACalls, postedEvents);
+                postedEvents += (error == ERROR_OK) ? 1UL : 0UL;
+            }
+
+            THEN ("not enough resources error shall occur")
+            {
+                REQUIRE (error == ERROR_NOT_ENOUGH_RESOURCES);
+                REQUIRE (postedEvents == 16UL);
+
+                AND_WHEN ("the main loop runs")
+                {
+                    Scheduler_Run();
+
+                    THEN ("the queued events shall be handled and the queue shall accept events again")
+                    {
+                        REQUIRE (handledEventCount == 16UL);
+                        REQUIRE (handledEvents[15] == 15UL);
+                        REQUIRE (Scheduler_PostEvent(Helper_EventHandler, &taskACalls, 0UL) == ERROR_OK);
+                    }
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------
+// Scheduler_GetTaskStats
+//------------------------------------
+
+SCENARIO ("Task cycles are measured", "[scheduler]")
+{
+    GIVEN ("a 10 ms task that runs for 100, 300 and 200 cycles")
+    {
+        Helper_InitScheduler();
+        MOCK_SET_CUSTOM_FAKE(REG_READ_MOCK, REG_READ_CycleCounterFake);
+        cycleCounter = (uint32_t)UTestHelper::GetRandomInt(0, 100000);
+        REQUIRE (Helper_CreateTask(Helper_BusyTask, &busyCycles, 10U, &handleA) == ERROR_OK);
+
+        const uint32_t aBusyCycles[] = {100UL, 300UL, 200UL};
+        for (uint32_t cycles : aBusyCycles)
+        {
+            busyCycles = cycles;
+            Helper_AdvanceTicks(10UL);
+        }
+
+        WHEN ("the task statistics are read")
+        {
+            TaskStats_t stats;
+            Error_t error = Scheduler_GetTaskStats(handleA, &stats);
+
+            THEN ("the calls shall be accounted")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (stats.calls == 3UL);
+                REQUIRE (stats.minCycles == 100UL);
+                REQUIRE (stats.maxCycles == 300UL);
+                REQUIRE (stats.meanCycles == 200UL);
+                REQUIRE (stats.overruns == 0UL);
+            }
+        }
+
+        WHEN ("the main loop is blocked over three deadlines")
+        {
+            for (uint32_t i = 0UL; i < 35UL; ++i)
+            {
+                SysTick_Handler();
+            }
+            Scheduler_Run();
+
+            THEN ("the missed deadlines shall be counted as overruns")
+            {
+                TaskStats_t stats;
+                REQUIRE (Scheduler_GetTaskStats(handleA, &stats) == ERROR_OK);
+                REQUIRE (stats.calls == 4UL);
+                REQUIRE (stats.overruns == 2UL);
+            }
+        }
+    }
+
+    GIVEN ("a task has not been called")
+    {
+        Helper_InitScheduler();
+        REQUIRE (Helper_CreateTask(Helper_CountingTask, &taskACalls, 10U, &handleA) == ERROR_OK);
+
+        WHEN ("the task statistics are read")
+        {
+            TaskStats_t stats;
+            Error_t error = Scheduler_GetTaskStats(handleA, &stats);
+
+            THEN ("the statistics shall be empty")
+            {
+                REQUIRE (error == ERROR_OK);
+                REQUIRE (stats.calls == 0UL);
+                REQUIRE (stats.minCycles == 0UL);
+                REQUIRE (stats.maxCycles == 0UL);
+                REQUIRE (stats.meanCycles == 0UL);
+                REQUIRE (stats.overruns == 0UL);
+            }
+        }
+    }
+}
+
+SCENARIO ("Task statistics read fails", "[scheduler][error_handling]")
+{
+    GIVEN ("a task has been deleted")
+    {
+        Helper_InitScheduler();
+        REQUIRE (Helper_CreateTask(Helper_CountingTask, &taskACalls, 10U, &handleA) == ERROR_OK);
+        REQUIRE (Scheduler_DeleteTask(handleA) == ERROR_OK);
+
+        WHEN ("the statistics of the deleted task are read")
+        {
+            TaskStats_t stats;
+            Error_t error = Scheduler_GetTaskStats(handleA, &stats);
+
+            THEN ("an invalid action error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+            }
+        }
+
+        WHEN ("the statistics are read without a destination")
+        {
+            Error_t error = Scheduler_GetTaskStats(handleA, NULL);
+
+            THEN ("assert error shall occur")
+            {
+                REQUIRE (error == ERROR_INVALID_ACTION);
+                REQUIRE (ASSERT_ERROR);
+                REQUIRE (ASSERT_ERROR_TYPE_IS(SCHEDULER_FAILURE));
+            }
+        }
+    }
+}
+
+SCENARIO ("Tick handler cycles are measured", "[scheduler]")
+{
+    GIVEN ("the scheduler is initialised")
+    {
+        Helper_InitScheduler();
+
+        AND_GIVEN ("the cycle counter reads give 42 and then 17 cycle handler run times")
+        {
+            uint32_t aCycleCounts[] = {1000UL, 1042UL, 2000UL, 2017UL};
+            MOCK_SET_RETURN_VALUE_SEQUENCE(REG_READ_MOCK, aCycleCounts, ARRAY_LENGTH(aCycleCounts, uint32_t));
+
+            WHEN ("two ticks pass")
+            {
+                SysTick_Handler();
+                SysTick_Handler();
+
+                THEN ("the worst case shall be reported")
+                {
+                    REQUIRE (MOCK_ARG_HISTORY(REG_READ_MOCK, 0, 0) == &DWT->CYCCNT);
+                    REQUIRE (Scheduler_GetMaxTickCycles() == 42UL);
+                }
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Helper Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+static void Helper_CountingTask(void* pContext)
+{
+    ++(*(int*)pContext);
+    return;
+}
+
+static void Helper_RecordingTask(void* pContext)
+{
+    Recording_t* pRecording = (Recording_t*)pContext;
+    uint32_t now = Scheduler_GetTicks();
+    uint32_t expected = pRecording->startTick + ((pRecording->calls + 1UL) * pRecording->interval);
+    if (now != expected)
+    {
+        ++pRecording->errors;
+    }
+    if (isVirtualTimeChecked && (now != (uint32_t)(virtualTime.cycles / (SystemCoreClock / 1000UL))))
+    {
+        ++pRecording->errors;
+    }
+    ++pRecording->calls;
+    pRecording->lastTick = now - pRecording->startTick;
+    return;
+}
+
+static void Helper_BusyTask(void* pContext)
+{
+    cycleCounter += *(uint32_t*)pContext;
+    return;
+}
+
+static void Helper_EventHandler(void* pContext, uint32_t data)
+{
+    REQUIRE (pContext == &taskACalls);
+    if (handledEventCount < maxHandledEvents)
+    {
+        handledEvents[handledEventCount] = data;
+    }
+    ++handledEventCount;
+    return;
+}
+
+static void Helper_FirstCallTask(void* pContext)
+{
+    uint32_t* pFirstCallTick = (uint32_t*)pContext;
+    if (*pFirstCallTick == 0UL)
+    {
+        *pFirstCallTick = Scheduler_GetTicks();
+    }
+    return;
+}
+
+static void Helper_TimerTask(void* pContext)
+{
+    TimerRecord_t* pRecord = (TimerRecord_t*)pContext;
+    ++pRecord->calls;
+    pRecord->lastTick = Scheduler_GetTicks();
+    return;
+}
+
+static void Helper_OrderTask(void* pContext)
+{
+    if (callOrderCount < maxCallOrder)
+    {
+        callOrder[callOrderCount] = *(const uint32_t*)pContext;
+        ++callOrderCount;
+    }
+    return;
+}
+
+static void Helper_BlockingTask(void* pContext)
+{
+    for (uint32_t i = 0UL; i < *(const uint32_t*)pContext; ++i)
+    {
+        SysTick_Handler();
+        Helper_TakeDispatchExceptions();
+    }
+    return;
+}
+
+static void Helper_PreemptedTask(void* pContext)
+{
+    for (uint32_t i = 0UL; i < *(const uint32_t*)pContext; ++i)
+    {
+        SysTick_Handler();
+        UART8_IRQHandler();
+        UART7_IRQHandler();
+    }
+    return;
+}
+
+static void Helper_CoroutineTask(void* pContext)
+{
+    CoroutineContext_t* pCoroutineContext = (CoroutineContext_t*)pContext;
+    COROUTINE_BEGIN(&pCoroutineContext->coroutine);
+    ++pCoroutineContext->steps;
+    COROUTINE_WAIT_UNTIL(&pCoroutineContext->coroutine, pCoroutineContext->isEventSet);
+    pCoroutineContext->isEventSet = false;
+    ++pCoroutineContext->steps;
+    COROUTINE_YIELD(&pCoroutineContext->coroutine);
+    ++pCoroutineContext->steps;
+    COROUTINE_END(&pCoroutineContext->coroutine);
+    return;
+}
+
+static Error_t Helper_CreateTask(Task_t Task, void* pContext, uint16_t interval, TaskHandle_t* pHandle)
+{
+    const TaskConfig_t config = {.Task = Task, .pContext = pContext, .interval = interval};
+    return Scheduler_CreateTask(&config, pHandle);
+}
+
+static Error_t Helper_CreatePriorityTask(Task_t Task, void* pContext, uint16_t interval, uint8_t priority,
+                                         TaskHandle_t* pHandle)
+{
+    const TaskConfig_t config = {.Task = Task, .pContext = pContext, .interval = interval, .priority = priority};
+    return Scheduler_CreateTask(&config, pHandle);
+}
+
+static void Helper_CreateRecordingTasks(const uint16_t* pIntervals, size_t count)
+{
+    for (size_t i = 0U; i < count; ++i)
+    {
+        recordings[i] = {.interval = pIntervals[i], .startTick = Scheduler_GetTicks(), .calls = 0UL, .lastTick = 0UL,
+                         .errors = 0UL};
+        TaskHandle_t handle;
+        REQUIRE (Helper_CreateTask(Helper_RecordingTask, &recordings[i], pIntervals[i], &handle) == ERROR_OK);
+    }
+    return;
+}
+
+static void Helper_InitScheduler(void)
+{
+    FFF_RESET_HISTORY();
+    CMSIS_MOCK_RESET();
+    HAL_MOCK_RESET();
+    SYSTEM_MOCK_RESET();
+    taskACalls = 0;
+    taskBCalls = 0;
+    callOrderCount = 0UL;
+    isVirtualTimeChecked = false;
+    (void)Scheduler_Init();
+    return;
+}
+
+static void Helper_InitVirtualTime(uint64_t wakeUpPeriod)
+{
+    FFF_RESET_HISTORY();
+    CMSIS_MOCK_RESET();
+    HAL_MOCK_RESET();
+    SYSTEM_MOCK_RESET();
+    MOCK_SET_CUSTOM_FAKE(REG_READ_MOCK, REG_READ_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(REG_WRITE_MOCK, REG_WRITE_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(SET_BIT_MOCK, SET_BIT_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(CLEAR_BIT_MOCK, CLEAR_BIT_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(GET_BIT_MOCK, GET_BIT_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(SysTick_Config, SysTick_Config_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(__WFI, __WFI_CustomFake);
+    MOCK_SET_CUSTOM_FAKE(__set_PRIMASK, __set_PRIMASK_CustomFake);
+
+    virtualTime = {};
+    virtualTime.wakeUpPeriod = wakeUpPeriod;
+    virtualTime.nextWakeUp = wakeUpPeriod;
+    isVirtualTimeChecked = true;
+    (void)Scheduler_Init();
+    return;
+}
+
+static void Helper_RunVirtualTime(uint32_t tickCount)
+{
+    const uint64_t loopCycles = 50UL;
+    uint64_t endCycles = virtualTime.cycles + ((uint64_t)tickCount * (SystemCoreClock / 1000UL));
+    while (virtualTime.cycles < endCycles)
+    {
+        Scheduler_Run();
+        Helper_ExecuteVirtualCycles(loopCycles);
+        Scheduler_Idle();
+    }
+    return;
+}
+
+static void Helper_ExecuteVirtualCycles(uint64_t cycles)
+{
+    while (cycles > 0UL)
+    {
+        cycles -= Helper_AdvanceVirtualClock(cycles);
+        if (virtualTime.isPending)
+        {
+            virtualTime.isPending = false;
+            ++virtualTime.interrupts;
+            SysTick_Handler();
+            Helper_TakeDispatchExceptions();
+        }
+    }
+    return;
+}
+
+static uint64_t Helper_AdvanceVirtualClock(uint64_t cycles)
+{
+    uint64_t step = cycles;
+    if (virtualTime.isEnabled)
+    {
+        // The counter reloads on the cycle after reaching zero and interrupts when it reaches zero again.
+        if (virtualTime.value == 0UL)
+        {
+            virtualTime.value = virtualTime.load + 1UL;
+        }
+        if (step > virtualTime.value)
+        {
+            step = virtualTime.value;
+        }
+        virtualTime.value -= (uint32_t)step;
+        if (virtualTime.value == 0UL)
+        {
+            virtualTime.isPending = true;
+        }
+    }
+    virtualTime.cycles += step;
+    return step;
+}
+
+static void Helper_AdvanceTicks(uint32_t tickCount)
+{
+    for (uint32_t i = 0UL; i < tickCount; ++i)
+    {
+        SysTick_Handler();
+        Helper_TakeDispatchExceptions();
+        Scheduler_Run();
+    }
+    return;
+}
+
+static void Helper_TakeDispatchExceptions(void)
+{
+    UART8_IRQHandler();
+    UART7_IRQHandler();
+    PendSV_Handler();
+    return;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Custom Fake Definitions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+static uint32_t REG_READ_CycleCounterFake(uint32_t* pRegister)
+{
+    return (pRegister == &DWT->CYCCNT) ? cycleCounter : 0UL;
+}
+
+static uint32_t REG_READ_CustomFake(uint32_t* pRegister)
+{
+    uint32_t value;
+    if (pRegister == &SysTick->VAL)
+    {
+        value = virtualTime.value;
+    }
+    else if (pRegister == &DWT->CYCCNT)
+    {
+        value = (uint32_t)virtualTime.cycles;
+    }
+    else
+    {
+        value = *pRegister;
+    }
+    return value;
+}
+
+static void REG_WRITE_CustomFake(uint32_t* pRegister, uint32_t value)
+{
+    if (pRegister == &SysTick->VAL)
+    {
+        // Any write clears the counter.
+        virtualTime.value = 0UL;
+    }
+    else if (pRegister == &SysTick->LOAD)
+    {
+        virtualTime.load = value;
+    }
+    else
+    {
+        *pRegister = value;
+    }
+    return;
+}
+
+static void SET_BIT_CustomFake(uint32_t* pRegister, uint32_t bit)
+{
+    if ((pRegister == &SysTick->CTRL) && (bit == SysTick_CTRL_ENABLE_Pos))
+    {
+        virtualTime.isEnabled = true;
+        // The first clock after enabling a cleared counter reloads it before the next instruction.
+        if (virtualTime.value == 0UL)
+        {
+            virtualTime.value = virtualTime.load;
+            ++virtualTime.cycles;
+        }
+    }
+    else
+    {
+        *pRegister |= (1UL << bit);
+    }
+    return;
+}
+
+static void CLEAR_BIT_CustomFake(uint32_t* pRegister, uint32_t bit)
+{
+    if ((pRegister == &SysTick->CTRL) && (bit == SysTick_CTRL_ENABLE_Pos))
+    {
+        virtualTime.isEnabled = false;
+    }
+    else
+    {
+        *pRegister &= ~(1UL << bit);
+    }
+    return;
+}
+
+static bool GET_BIT_CustomFake(uint32_t* pRegister, uint32_t bit)
+{
+    bool isSet;
+    if ((pRegister == &SCB->ICSR) && (bit == SCB_ICSR_PENDSTSET_Pos))
+    {
+        isSet = virtualTime.isPending;
+    }
+    else
+    {
+        isSet = ((*pRegister & (1UL << bit)) != 0UL);
+    }
+    return isSet;
+}
+
+static uint32_t SysTick_Config_CustomFake(uint32_t ticks)
+{
+    REG_WRITE_CustomFake(&SysTick->LOAD, ticks - 1UL);
+    REG_WRITE_CustomFake(&SysTick->VAL, 0UL);
+    SET_BIT_CustomFake(&SysTick->CTRL, SysTick_CTRL_ENABLE_Pos);
+    return 0UL;
+}
+
+static void __WFI_CustomFake(void)
+{
+    ++virtualTime.sleeps;
+    bool isWokenUp = virtualTime.isPending;
+    while (isWokenUp == false)
+    {
+        uint64_t cycles = UINT64_MAX;
+        if (virtualTime.wakeUpPeriod > 0UL)
+        {
+            cycles = virtualTime.nextWakeUp - virtualTime.cycles;
+        }
+        REQUIRE ((virtualTime.isEnabled || (virtualTime.wakeUpPeriod > 0UL)));
+        (void)Helper_AdvanceVirtualClock(cycles);
+
+        if ((virtualTime.wakeUpPeriod > 0UL) && (virtualTime.cycles >= virtualTime.nextWakeUp))
+        {
+            virtualTime.nextWakeUp += virtualTime.wakeUpPeriod;
+            isWokenUp = true;
+        }
+        isWokenUp = isWokenUp || virtualTime.isPending;
+    }
+    return;
+}
+
+static void __set_PRIMASK_CustomFake(uint32_t priMask)
+{
+    if ((priMask == 0UL) && virtualTime.isPending)
+    {
+        virtualTime.isPending = false;
+        ++virtualTime.interrupts;
+        SysTick_Handler();
+    }
+    return;
+}